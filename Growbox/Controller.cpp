@@ -26,6 +26,9 @@ ControllerClass::ControllerClass() :
 
 void ControllerClass::rebootController() {
   showControllerMessage(F("Reboot"));
+  GB_Logger.flushLogRecords(); // store deferred changes
+  GB_StorageHelper.commitLogDayIndex();
+  GB_StorageHelper.commitBootRecordCache();
   void (*resetFunc)(void) = 0; // initialize Software Reset function
   resetFunc(); // call zero pointer
 }
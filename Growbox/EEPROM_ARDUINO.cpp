@@ -86,5 +86,18 @@ void EEPROM_ARDUINO_Class::read_block(const word address, void *data, const word
   eeprom_read_block(data, (uint8_t*)address, sizeofData);
 }
 
+word EEPROM_ARDUINO_Class::update_block(const word address, const void* data, const word sizeofData) {
+  // Internal EEPROM writes byte by byte (3.3 ms each), so we write only changed bytes
+  word writeCount = 0;
+  const byte* bytePointer = (const byte*)data;
+  for (word i = 0; i < sizeofData; i++) {
+    if (read_byte(address + i) != bytePointer[i]) {
+      write_byte(address + i, bytePointer[i]);
+      writeCount++;
+    }
+  }
+  return writeCount;
+}
+
 EEPROM_ARDUINO_Class EEPROM;
 
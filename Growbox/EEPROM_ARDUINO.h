@@ -35,9 +35,7 @@ public:
       if ((address + items * sizeof(T) - 1) >= getCapacity()) {
         return;
       }
-      for (word i = 0; i < items; i++) {
-        value[i] = readBlock<T>(address + i * sizeof(T));
-      }
+      read_block(address, value, items * sizeof(T));
     }
 
   template<class T>
@@ -55,11 +53,8 @@ public:
       if ((address + items * sizeof(T) - 1) >= getCapacity()) {
         return 0;
       }
-      word rez;
-      for (word i = 0; i < items; i++) {
-        rez += writeBlock<T>(address + (i * sizeof(T)), value[i]);
-      }
-      return rez;
+      write_block(address, value, items * sizeof(T));
+      return items * sizeof(T);
     }
 
   template<class T>
@@ -77,29 +72,15 @@ public:
       if ((address + items * sizeof(T) - 1) >= getCapacity()) {
         return 0;
       }
-      word rez = 0;
-      for (word i = 0; i < items; i++) {
-        rez += updateBlock<T>(address + i * sizeof(T), value[i]);
-      }
-      return rez;
+      return update_block(address, value, items * sizeof(T));
     }
 
   template<class T>
     int updateBlock(word address, const T& value) {
-      word writeCount = 0;
       if ((address + sizeof(value) - 1) >= getCapacity()) {
         return 0;
       }
-      const byte* bytePointer = (const byte*)(const void*)&value;
-      for (word i = 0; i < sizeof(value); i++) {
-        if (read_byte(address) != *bytePointer) {
-          write_byte(address, *bytePointer);
-          writeCount++;
-        }
-        address++;
-        bytePointer++;
-      }
-      return writeCount;
+      return update_block(address, &value, sizeof(value));
     }
 
 private:
@@ -107,6 +88,7 @@ private:
   virtual byte read_byte(word address);
   virtual void write_block(const word address, const void* data, const word sizeofData);
   virtual void read_block(const word address, void* data, const word sizeofData);
+  virtual word update_block(const word address, const void* data, const word sizeofData); // returns count of changed bytes
 
 };
 
@@ -4,6 +4,9 @@
 
 #define AT24C32_I2C_ADDRESS   0x50 // External EEPROM I2C address
 #define AT24C32_CAPACITY      0x1000
+#define AT24C32_PAGE_SIZE     32   // 32-byte page write, address counter rolls over inside page (see spec)
+#define AT24C32_WRITE_CYCLE_TIMEOUT_MS 20 // tWR is 10 ms max at 5V, 20 ms at 1.8V
+#define AT24C32_WIRE_ADDRESS_SIZE 2 // MSB + LSB, they are stored in Wire buffer too
 
 word EEPROM_AT24C32_Class::getCapacity() {
   return AT24C32_CAPACITY;  // 4K byte = 32K bit
@@ -22,39 +25,111 @@ void EEPROM_AT24C32_Class::write_byte(const word address, const byte data) {
   Wire.write((byte)(address & 0xFF)); // LSB
   Wire.write(data);
   Wire.endTransmission();
-  delay(10);  // http://www.hobbytronics.co.uk/arduino-external-eeprom
+  waitWriteCycle();
 }
 
 byte EEPROM_AT24C32_Class::read_byte(word address) {
-  Wire.beginTransmission(AT24C32_I2C_ADDRESS);
-  Wire.write((byte)(address >> 8)); // MSB
-  Wire.write((byte)(address & 0xFF)); // LSB
-  Wire.endTransmission();
-  delay(10);  // http://www.hobbytronics.co.uk/arduino-external-eeprom
-  Wire.requestFrom(AT24C32_I2C_ADDRESS, 1);
-  if (Wire.available()) {
-    return Wire.read();
-  }
-  else {
-    return 0;
-  }
+  byte value;
+  read_block(address, &value, 1);
+  return value;
 }
 
 void EEPROM_AT24C32_Class::write_block(const word address, const void* data, const word sizeofData) {
-  // We have problems with sequental read/write (internal counter has only 5 bits, see spec)
-  for (word c = 0; c < sizeofData; c++) {
-    byte value = ((byte*)data)[c];
-    write(address + c, value);
+  // One transaction per page. Internal counter has only 5 bits, so we never cross page boundary (see spec)
+  const byte* bytePointer = (const byte*)data;
+  word offset = 0;
+  while (offset < sizeofData) {
+    word chunkSize = getPageChunkSize(address + offset, sizeofData - offset, BUFFER_LENGTH - AT24C32_WIRE_ADDRESS_SIZE);
+
+    Wire.beginTransmission(AT24C32_I2C_ADDRESS);
+    Wire.write((byte)((address + offset) >> 8)); // MSB
+    Wire.write((byte)((address + offset) & 0xFF)); // LSB
+    Wire.write(bytePointer + offset, chunkSize);
+    Wire.endTransmission();
+    waitWriteCycle();
+
+    offset += chunkSize;
   }
 }
 
 void EEPROM_AT24C32_Class::read_block(const word address, void *data, const word sizeofData) {
-  // We have problems with sequental read/write (internal counter has only 5 bits, see spec)
-  for (word c = 0; c < sizeofData; c++) {
-    byte value = read(address + c);
-    ((byte*)data)[c] = value;
+  // Sequential read, up to Wire buffer size per transaction. Internal counter has only 5 bits,
+  // so we start new transaction on each page boundary (see spec)
+  byte* bytePointer = (byte*)data;
+  word offset = 0;
+  while (offset < sizeofData) {
+    word chunkSize = getPageChunkSize(address + offset, sizeofData - offset, BUFFER_LENGTH);
+
+    Wire.beginTransmission(AT24C32_I2C_ADDRESS);
+    Wire.write((byte)((address + offset) >> 8)); // MSB
+    Wire.write((byte)((address + offset) & 0xFF)); // LSB
+    Wire.endTransmission();
+    Wire.requestFrom(AT24C32_I2C_ADDRESS, (int)chunkSize);
+    for (word i = 0; i < chunkSize; i++) {
+      if (Wire.available()) {
+        bytePointer[offset + i] = Wire.read();
+      }
+      else {
+        bytePointer[offset + i] = 0;
+      }
+    }
+
+    offset += chunkSize;
   }
 }
 
+word EEPROM_AT24C32_Class::update_block(const word address, const void* data, const word sizeofData) {
+  // Page write costs the same time for 1 or 30 bytes, so we rewrite changed span inside each page
+  const byte* bytePointer = (const byte*)data;
+  byte storedData[AT24C32_PAGE_SIZE];
+  word writeCount = 0;
+  word offset = 0;
+  while (offset < sizeofData) {
+    word chunkSize = getPageChunkSize(address + offset, sizeofData - offset, BUFFER_LENGTH - AT24C32_WIRE_ADDRESS_SIZE);
+
+    read_block(address + offset, storedData, chunkSize);
+    word firstChangedIndex = chunkSize, lastChangedIndex = 0;
+    for (word i = 0; i < chunkSize; i++) {
+      if (storedData[i] != bytePointer[offset + i]) {
+        if (firstChangedIndex == chunkSize) {
+          firstChangedIndex = i;
+        }
+        lastChangedIndex = i;
+        writeCount++;
+      }
+    }
+    if (firstChangedIndex < chunkSize) {
+      write_block(address + offset + firstChangedIndex, bytePointer + offset + firstChangedIndex, lastChangedIndex - firstChangedIndex + 1);
+    }
+
+    offset += chunkSize;
+  }
+  return writeCount;
+}
+
+word EEPROM_AT24C32_Class::getPageChunkSize(const word address, const word sizeofData, const word maxChunkSize) {
+  word chunkSize = AT24C32_PAGE_SIZE - (address % AT24C32_PAGE_SIZE); // till the end of page
+  if (chunkSize > maxChunkSize) {
+    chunkSize = maxChunkSize; // Wire buffer is 32 bytes only
+  }
+  if (chunkSize > sizeofData) {
+    chunkSize = sizeofData;
+  }
+  return chunkSize;
+}
+
+// Acknowledge polling: device doesn't acknowledge its address until internal write cycle completed (see spec)
+boolean EEPROM_AT24C32_Class::waitWriteCycle() {
+  unsigned long start = millis();
+  do {
+    Wire.beginTransmission(AT24C32_I2C_ADDRESS);
+    if (Wire.endTransmission() == 0) {
+      return true;
+    }
+  }
+  while (millis() - start <= AT24C32_WRITE_CYCLE_TIMEOUT_MS);
+  return false;
+}
+
 EEPROM_AT24C32_Class EEPROM_AT24C32;
 
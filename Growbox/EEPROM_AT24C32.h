@@ -16,10 +16,13 @@ private:
   virtual byte read_byte(word address);
   virtual void write_block(const word address, const void* data, const word sizeofData);
   virtual void read_block(const word address, void *data, const word sizeofData);
+  virtual word update_block(const word address, const void* data, const word sizeofData);
+
+  word getPageChunkSize(const word address, const word sizeofData, const word maxChunkSize);
+  boolean waitWriteCycle();
 
 };
 
 extern EEPROM_AT24C32_Class EEPROM_AT24C32;
 
 #endif
-
@@ -152,6 +152,11 @@ void setup() {
   printStatusOnBoot(F("stored configuration"));
   GB_StorageHelper.init_loadConfiguration(startupTimeStamp); // Logger will enabled after that. After set clock and load configuration we are ready for logging
   GB_Controller.checkFreeMemory();
+  if (g_useSerialMonitor) {
+    Serial.print(F("Log head restored in "));
+    Serial.print(GB_StorageHelper.getStorageStatistics().logHeadRestoreTime);
+    Serial.println(F(" us"));
+  }
 
   GB_Controller.initClock_afterLoadConfiguration(); // Save 'auto calculated' flag
   GB_Controller.checkFreeMemory();
@@ -194,6 +199,18 @@ void loop() {
 
   // We use another instance of Alarm object to increase MAX alarms count (6 by default, look dtNBR_ALARMS in TimeAlarms.h
   GB_Watering.updateAlarms();
+
+  // Requests received during response to another Wi-Fi client
+  if (RAK410_XBeeWifi.isRequestQueued()) {
+    serialEvent1();
+  }
+
+  // Connections kept alive after response are closed, when client is silent
+  RAK410_XBeeWifi.closeIdleConnections();
+
+  // Alarms and Serial events change preferences and log in RAM only, store them once per loop
+  GB_Logger.flushLogRecords();
+  GB_StorageHelper.commitBootRecordCache();
 }
 
 // Arduino IDE is connected to Serial and works on standard 9600 speed
@@ -1,6 +1,11 @@
 #include "Logger.h"
 
 #include "StorageHelper.h"
+#include "PrintUtils.h"
+
+LoggerClass::LoggerClass() :
+    c_pendingLogRecordsCount(0), c_isFlushing(false) {
+}
 
 /////////////////////////////////////////////////////////////////////
 //                             APPEND                              //
@@ -11,8 +16,8 @@
 //   DDDDDD - event identificator
 void LoggerClass::logEvent(Event &event, byte value) {
   LogRecord logRecord(B00000000 | event.index, value);
-  boolean isStored = GB_StorageHelper.storeLogRecord(logRecord);
-  printLogRecordToSerialMonotior(logRecord, event.description, isStored);
+  boolean isBuffered = storeLogRecord(logRecord);
+  printLogRecordToSerialMonotior(logRecord, event.description, isBuffered, false);
 }
 
 // Watering event uses format [10SSDDDD]
@@ -21,8 +26,8 @@ void LoggerClass::logEvent(Event &event, byte value) {
 //   DDDD - event identificator
 void LoggerClass::logWateringEvent(byte wsIndex, WateringEvent& wateringEvent, byte value) {
   LogRecord logRecord(B10000000 | ((B00000011 & wsIndex) << 4) | (B00001111 & wateringEvent.index), value);
-  boolean isStored = GB_StorageHelper.storeLogRecord(logRecord);
-  printLogRecordToSerialMonotior(logRecord, wateringEvent.description, isStored);
+  boolean isBuffered = storeLogRecord(logRecord);
+  printLogRecordToSerialMonotior(logRecord, wateringEvent.description, isBuffered, false);
 }
 
 // Error events uses format [01SSDDDD] 
@@ -33,11 +38,14 @@ void LoggerClass::logError(Error &error) {
   LogRecord logRecord(B01000000 | ((B00000011 & (error.sequenceSize - 1)) << 4) | (B00001111 & error.sequence));
   error.isActive = true;
   boolean isStoredNow = false;
-  if (!error.isStored) {
-    error.isStored = GB_StorageHelper.storeLogRecord(logRecord);
+  // Error can be followed by hang or reboot, so it is stored at once. Error of storage, that is
+  // found during flush, is not stored and is logged again on next check
+  if (!error.isStored && !c_isFlushing && GB_StorageHelper.canStoreLogRecords()) {
+    flushLogRecords(); // keep order of records
+    error.isStored = (storeLogRecordsNow(&logRecord, 1) == 1);
     isStoredNow = error.isStored;
   }
-  printLogRecordToSerialMonotior(logRecord, error.description, isStoredNow);
+  printLogRecordToSerialMonotior(logRecord, error.description, false, isStoredNow);
   //error.isStored = true;   
   error.notify();
 }
@@ -56,25 +64,73 @@ boolean LoggerClass::stopLogError(Error &error) {
 //   TTTTTT - temperature [0..2^6] = [0..64]
 void LoggerClass::logTemperature(byte temperature) {
   LogRecord logRecord(B11000000 | temperature);
-  boolean isStored = GB_StorageHelper.storeLogRecord(logRecord);
-  printLogRecordToSerialMonotior(logRecord, F("Temperature"), isStored, temperature);
+  boolean isBuffered = storeLogRecord(logRecord);
+  printLogRecordToSerialMonotior(logRecord, F("Temperature"), isBuffered, false, temperature);
+}
+
+// Storage can log events while records are stored, they are buffered and stored by next flush.
+// Returns false, if some records were not stored, they are lost
+boolean LoggerClass::flushLogRecords() {
+  if (c_pendingLogRecordsCount == 0) {
+    return true;
+  }
+  if (c_isFlushing) {
+    return false;
+  }
+  LogRecord logRecords[LOGGER_PENDING_RECORDS_CAPACITY];
+  byte logRecordsCount = c_pendingLogRecordsCount;
+  memcpy(logRecords, c_pendingLogRecords, logRecordsCount * sizeof(LogRecord));
+  c_pendingLogRecordsCount = 0;
+
+  byte storedCount = storeLogRecordsNow(logRecords, logRecordsCount);
+  if (storedCount < logRecordsCount && g_useSerialMonitor) {
+    Serial.print(F("LOG> NOT STORED "));
+    Serial.print(logRecordsCount - storedCount);
+    Serial.println(F(" buffered records"));
+  }
+  return (storedCount == logRecordsCount);
+}
+
+// private:
+
+// Errors, logged by storage meanwhile, are not stored recursively
+byte LoggerClass::storeLogRecordsNow(const LogRecord logRecords[], byte logRecordsCount) {
+  c_isFlushing = true;
+  byte storedCount = GB_StorageHelper.storeLogRecords(logRecords, logRecordsCount);
+  c_isFlushing = false;
+  return storedCount;
+}
+
+boolean LoggerClass::storeLogRecord(const LogRecord &logRecord) {
+  if (!GB_StorageHelper.canStoreLogRecords()) {
+    return false;
+  }
+  if (c_pendingLogRecordsCount >= LOGGER_PENDING_RECORDS_CAPACITY) {
+    flushLogRecords();
+    if (c_pendingLogRecordsCount >= LOGGER_PENDING_RECORDS_CAPACITY) {
+      return false; // buffer is filled during flush
+    }
+  }
+  c_pendingLogRecords[c_pendingLogRecordsCount++] = logRecord;
+  if (c_pendingLogRecordsCount == LOGGER_PENDING_RECORDS_CAPACITY) {
+    flushLogRecords();
+  }
+  return true;
 }
 
 /////////////////////////////////////////////////////////////////////
 //                              CHECK                              //
 /////////////////////////////////////////////////////////////////////
 
-String LoggerClass::getLogRecordPrefix(const LogRecord &logRecord) {
-  String out;
-  out += '[';
-  out += StringUtils::timeStampToString(logRecord.timeStamp);
-  out += StringUtils::flashStringLoad(F("] ["));
-  out += StringUtils::byteToHexString(logRecord.data, true);
-  out += StringUtils::flashStringLoad(F("] "));
-  return out;
+void LoggerClass::printLogRecordPrefix(Print& out, const LogRecord &logRecord) {
+  out.print('[');
+  PrintUtils::printTimeStamp(out, logRecord.timeStamp);
+  out.print(F("] ["));
+  PrintUtils::printHexByte(out, logRecord.data, true);
+  out.print(F("] "));
 }
 
-const __FlashStringHelper* LoggerClass::getLogRecordDescription(LogRecord &logRecord) {
+const __FlashStringHelper* LoggerClass::getLogRecordDescription(const LogRecord &logRecord) {
 
   if (logRecord.isEmpty()) {
     return F("Log record not loaded");
@@ -119,52 +175,97 @@ const __FlashStringHelper* LoggerClass::getLogRecordDescription(LogRecord &logRe
   }
 }
 
-String LoggerClass::getLogRecordDescriptionSuffix(const LogRecord &logRecord, boolean formatForHtml) {
-
-  String out;
+void LoggerClass::printLogRecordDescriptionSuffix(Print& out, const LogRecord &logRecord, boolean formatForHtml) {
   if (logRecord.isEmpty()) {
-    return out;
+    return;
   }
   if (isEvent(logRecord)) {
     if (logRecord.data == EVENT_FAN_ON_LOW.index || logRecord.data == EVENT_FAN_ON_HIGH.index){
       if (logRecord.data1 != 0) {
-        out += StringUtils::flashStringLoad(F(", "));
-        out += ((B11110000 & logRecord.data1) >> 4) * UPDATE_GROWBOX_STATE_DELAY_MINUTES;
-        out +='/';
-        out += (B00001111 & logRecord.data1) * UPDATE_GROWBOX_STATE_DELAY_MINUTES;
-        out += StringUtils::flashStringLoad(F(" min"));
+        out.print(F(", "));
+        out.print(((B11110000 & logRecord.data1) >> 4) * UPDATE_GROWBOX_STATE_DELAY_MINUTES);
+        out.print('/');
+        out.print((B00001111 & logRecord.data1) * UPDATE_GROWBOX_STATE_DELAY_MINUTES);
+        out.print(F(" min"));
       }
     }
   }else if (isWateringEvent(logRecord)) {
     byte wsIndex = ((logRecord.data & B00110000) >> 4);
-    out += StringUtils::flashStringLoad(F(" system #"));
-    out += (wsIndex + 1);
+    out.print(F(" system #"));
+    out.print(wsIndex + 1);
 
     byte wateringEventIndex = (logRecord.data & B00001111);
     WateringEvent* foundItemPtr = WateringEvent::findByKey(wateringEventIndex);
 
     if (foundItemPtr != NULL) {
       if (foundItemPtr->isData2Value) {
-        out += StringUtils::flashStringLoad(F(", value "));
-        out += logRecord.data1;
+        out.print(F(", value "));
+        out.print(logRecord.data1);
       }
       else if (foundItemPtr->isData2Duration) {
-        out += StringUtils::flashStringLoad(F(" during "));
-        out += logRecord.data1;
-        out += StringUtils::flashStringLoad(F(" sec"));
+        out.print(F(" during "));
+        out.print(logRecord.data1);
+        out.print(F(" sec"));
       }
     }
   }
   else if (isTemperature(logRecord)) {
     byte temperature = (logRecord.data & B00111111);
-    out += StringUtils::flashStringLoad(F(" "));
-    out += temperature;
+    out.print(F(" "));
+    out.print(temperature);
     if (formatForHtml) {
-      out += StringUtils::flashStringLoad(F("&deg;C"));
+      out.print(F("&deg;C"));
     }
   }
 
-  return out;
+}
+
+// Descriptions for log rendering in browser, see g_logRecordDescription() in Static/growbox.js.
+// Keys are 6 bit codes of LogRecord.data, like in getLogRecordDescription()
+void LoggerClass::printLogRecordDescriptionsScript(Print& out) {
+  out.print(F("var g_logDescriptions={e:{"));
+  for (byte code = 1; code <= B00111111; code++) {
+    Event* foundItemPtr = Event::findByKey(code);
+    if (foundItemPtr != NULL) {
+      out.print(code);
+      out.print(F(":'"));
+      out.print(foundItemPtr->description);
+      out.print(F("',"));
+    }
+  }
+  out.print(F("},w:{")); // [description, 1 if data1 is value, 2 if data1 is duration]
+  for (byte code = 1; code <= B00001111; code++) {
+    WateringEvent* foundItemPtr = WateringEvent::findByKey(code);
+    if (foundItemPtr != NULL) {
+      out.print(code);
+      out.print(F(":['"));
+      out.print(foundItemPtr->description);
+      out.print(F("',"));
+      out.print(foundItemPtr->isData2Value ? 1 : (foundItemPtr->isData2Duration ? 2 : 0));
+      out.print(F("],"));
+    }
+  }
+  out.print(F("},r:{"));
+  for (byte code = 0; code <= B00111111; code++) {
+    Error* foundItemPtr = Error::findByKey(code & B00001111, ((code & B00110000) >> 4) + 1);
+    if (foundItemPtr != NULL) {
+      out.print(code);
+      out.print(F(":'"));
+      out.print(foundItemPtr->description);
+      out.print(F("',"));
+    }
+  }
+  out.print(F("},fan:["));
+  out.print(EVENT_FAN_ON_LOW.index);
+  out.print(',');
+  out.print(EVENT_FAN_ON_HIGH.index);
+  out.print(F("],bold:["));
+  out.print(EVENT_FIRST_START_UP.index);
+  out.print(',');
+  out.print(EVENT_RESTART.index);
+  out.print(F("],step:"));
+  out.print(UPDATE_GROWBOX_STATE_DELAY_MINUTES);
+  out.print(F("};"));
 }
 
 boolean LoggerClass::isEvent(const LogRecord &logRecord) {
@@ -182,17 +283,21 @@ boolean LoggerClass::isTemperature(const LogRecord &logRecord) {
 
 //private:
 
-void LoggerClass::printLogRecordToSerialMonotior(const LogRecord &logRecord, const __FlashStringHelper* description, const boolean wasStored, const byte temperature) {
+// Buffered record is reported by flush, if it is not stored
+void LoggerClass::printLogRecordToSerialMonotior(const LogRecord &logRecord, const __FlashStringHelper* description, const boolean isBuffered, const boolean isStored, const byte temperature) {
   if (!g_useSerialMonitor) {
     return;
   }
   Serial.print(F("LOG> "));
-  if (!wasStored) {
+  if (isBuffered) {
+    Serial.print(F("BUFFERED "));
+  }
+  else if (!isStored) {
     Serial.print(F("NOT STORED "));
   }
-  Serial.print(getLogRecordPrefix(logRecord));
+  printLogRecordPrefix(Serial, logRecord);
   Serial.print(description);
-  Serial.print(getLogRecordDescriptionSuffix(logRecord, false));
+  printLogRecordDescriptionSuffix(Serial, logRecord, false);
 
   Serial.println();
 }
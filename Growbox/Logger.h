@@ -4,9 +4,12 @@
 #include "LoggerModel.h"
 #include "StorageModel.h"
 
+const byte LOGGER_PENDING_RECORDS_CAPACITY = 8;
+
 class LoggerClass{
 
 public:
+  LoggerClass();
 
   /////////////////////////////////////////////////////////////////////
   //                             APPEND                              //
@@ -20,13 +23,16 @@ public:
 
   void logTemperature(byte temperature);
 
+  boolean flushLogRecords();
+
   /////////////////////////////////////////////////////////////////////
   //                              CHECK                              //
   /////////////////////////////////////////////////////////////////////
 
-  String getLogRecordPrefix(const LogRecord &logRecord);
-  const __FlashStringHelper* getLogRecordDescription(LogRecord &logRecord);
-  String getLogRecordDescriptionSuffix(const LogRecord &logRecord, boolean formatForHtml);
+  void printLogRecordPrefix(Print& out, const LogRecord &logRecord);
+  const __FlashStringHelper* getLogRecordDescription(const LogRecord &logRecord);
+  void printLogRecordDescriptionSuffix(Print& out, const LogRecord &logRecord, boolean formatForHtml);
+  void printLogRecordDescriptionsScript(Print& out);
 
   boolean isEvent(const LogRecord &logRecord);
   boolean isWateringEvent(const LogRecord &logRecord);
@@ -35,7 +41,17 @@ public:
 
 private:
 
-  void printLogRecordToSerialMonotior(const LogRecord &logRecord, const __FlashStringHelper* description, const boolean isStored, const byte temperature = 0xFF);
+  // Records are stored to EEPROM in batches: when buffer is full, on error, at the end of
+  // main loop and before reboot. Records of current loop pass are lost on power cut, not more
+  // than LOGGER_PENDING_RECORDS_CAPACITY
+  LogRecord c_pendingLogRecords[LOGGER_PENDING_RECORDS_CAPACITY];
+  byte c_pendingLogRecordsCount;
+  boolean c_isFlushing;
+
+  boolean storeLogRecord(const LogRecord &logRecord);
+  byte storeLogRecordsNow(const LogRecord logRecords[], byte logRecordsCount);
+
+  void printLogRecordToSerialMonotior(const LogRecord &logRecord, const __FlashStringHelper* description, const boolean isBuffered, const boolean isStored, const byte temperature = 0xFF);
 
 };
 
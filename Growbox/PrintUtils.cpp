@@ -1,17 +1,24 @@
 #include "PrintUtils.h"
 
 void PrintUtils::printHEX(const String &input) {
-  for (unsigned int i = 0; i < input.length(); i++) {
-    byte c = input[i];
-    Serial.print(StringUtils::byteToHexString(c, 2));
-    if ((i + 1) < input.length()) {
+  printHEX(input.c_str(), input.length());
+}
+
+void PrintUtils::printHEX(const char* input, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    printHexByte(Serial, input[i], true);
+    if ((i + 1) < length) {
       Serial.print(' ');
     }
   }
 }
 
 void PrintUtils::printWithoutCRLF(const String &input) {
-  for (unsigned int i = 0; i < input.length(); i++) {
+  printWithoutCRLF(input.c_str(), input.length());
+}
+
+void PrintUtils::printWithoutCRLF(const char* input, size_t length) {
+  for (size_t i = 0; i < length; i++) {
     if (input[i] == '\r') {
       Serial.print(F("\\r"));
     }
@@ -32,3 +39,67 @@ void PrintUtils::printRAM(void *ptr, byte sizeOf) {
   }
 }
 
+void PrintUtils::printFixedDigits(Print& out, unsigned long number, byte numberOfDigits) {
+  char buffer[10];
+  if (numberOfDigits > sizeof(buffer)) {
+    numberOfDigits = sizeof(buffer);
+  }
+  for (byte i = numberOfDigits; i > 0; i--) {
+    buffer[i - 1] = '0' + (number % 10);
+    number /= 10;
+  }
+  out.write((const uint8_t*) buffer, numberOfDigits);
+}
+
+void PrintUtils::printHexByte(Print& out, byte number, boolean addPrefix) {
+  char buffer[4];
+  byte size = 0;
+  if (addPrefix) {
+    buffer[size++] = '0';
+    buffer[size++] = 'x';
+  }
+  byte digit = (number >> 4);
+  buffer[size++] = (digit < 10) ? ('0' + digit) : ('A' + digit - 10);
+  digit = (number & 0x0F);
+  buffer[size++] = (digit < 10) ? ('0' + digit) : ('A' + digit - 10);
+  out.write((const uint8_t*) buffer, size);
+}
+
+void PrintUtils::printFloat(Print& out, float number) {
+  int temp = number * 100;
+  int whole = temp / 100;
+  int fract = temp % 100;
+
+  out.print(whole);
+  out.print('.');
+  printFixedDigits(out, abs(fract), 2);
+}
+
+void PrintUtils::printTimeStamp(Print& out, time_t time, boolean getDate, boolean getTime) {
+  tmElements_t tm;
+  breakTime(time, tm);
+
+  if (getDate) {
+    printFixedDigits(out, tm.Day, 2);
+    out.print('.');
+    printFixedDigits(out, tm.Month, 2);
+    out.print('.');
+    printFixedDigits(out, tmYearToCalendar(tm.Year), 4);
+  }
+  if (getDate && getTime) {
+    out.print(' ');
+  }
+  if (getTime) {
+    printFixedDigits(out, tm.Hour, 2);
+    out.print(':');
+    printFixedDigits(out, tm.Minute, 2);
+    out.print(':');
+    printFixedDigits(out, tm.Second, 2);
+  }
+}
+
+void PrintUtils::printWordTime(Print& out, const word time) {
+  printFixedDigits(out, time / 60, 2);
+  out.print(':');
+  printFixedDigits(out, time % 60, 2);
+}
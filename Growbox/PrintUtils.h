@@ -7,11 +7,20 @@
 namespace PrintUtils {
 
   void printHEX(const String &input);
+  void printHEX(const char* input, size_t length);
 
   void printWithoutCRLF(const String &input);
+  void printWithoutCRLF(const char* input, size_t length);
 
   void printRAM(void *ptr, byte sizeOf);
 
+  // Formatting without String, same output as StringUtils functions
+  void printFixedDigits(Print& out, unsigned long number, byte numberOfDigits);
+  void printHexByte(Print& out, byte number, boolean addPrefix = false);
+  void printFloat(Print& out, float number);
+  void printTimeStamp(Print& out, time_t time, boolean getDate = true, boolean getTime = true);
+  void printWordTime(Print& out, const word time);
+
 }
 ;
 
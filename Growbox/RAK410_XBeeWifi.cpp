@@ -10,16 +10,45 @@
 const char S_WIFI_RESPONSE_WELLCOME[] PROGMEM = "Welcome to RAK410\r\n";
 const char S_WIFI_RESPONSE_ERROR[] PROGMEM = "ERROR";
 const char S_WIFI_RESPONSE_OK[] PROGMEM = "OK";
-const char S_WIFI_GET_[] PROGMEM = "GET /";
-const char S_WIFI_POST_[] PROGMEM = "POST /";
+const char S_WIFI_GET[] PROGMEM = "GET";
+const char S_WIFI_POST[] PROGMEM = "POST";
+const char S_WIFI_IF_NONE_MATCH[] PROGMEM = "if-none-match:"; // lower case, header names are case insensitive
+const char S_WIFI_ACCEPT_ENCODING[] PROGMEM = "accept-encoding:";
+const char S_WIFI_CONNECTION[] PROGMEM = "connection:";
+const char S_WIFI_GZIP[] PROGMEM = "gzip";
+const char S_WIFI_CLOSE[] PROGMEM = "close";
+const char S_WIFI_RECV_DATA[] PROGMEM = "at+recv_data=";
 
 RAK410_XBeeWifiClass::RAK410_XBeeWifiClass() :
     c_isWifiPresent(false),
     c_restartWifiOnNextUpdate(true),
     c_isWifiPrintCommandStarted(false),
     c_autoSizeFrameSize(0),
+    c_autoSizeFrameChunkStart(WIFI_NO_CHUNK),
+    c_isAutoSizeFrameFailed(false),
     c_lastWifiActivityTimeStamp(0),
-    c_isLastWifiStationMode(false) {
+    c_isLastWifiStationMode(false),
+    c_isCommandResponsePending(false),
+    c_isCommandResponseOK(true),
+    c_isWelcomeResponseExpected(false),
+    c_commandMillis(0),
+    c_connectedPortsMask(0),
+    c_lastServedPortDescriptor(WIFI_MAX_PORT_DESCRIPTORS - 1),
+    c_keptPortsMask(0),
+    c_nextRequestNumber(0),
+    c_postDataRequestIndex(WIFI_RECEIVE_NO_REQUEST),
+    c_postDataLength(0),
+    c_receiveState(RECEIVE_STATE_COMMAND),
+    c_receiveIndex(0),
+    c_receiveHttpHeader(RECEIVE_HTTP_HEADER_NAME),
+    c_receiveHeaderIndex(0),
+    c_receiveRequestIndex(WIFI_RECEIVE_NO_REQUEST),
+    c_receivePortDescriptor(0xFF),
+    c_receiveDataLength(0),
+    c_receiveMillis(0) {
+  for (byte i = 0; i < WIFI_REQUEST_QUEUE_SIZE; i++) {
+    c_requests[i].state = WIFI_REQUEST_STATE_FREE;
+  }
 }
 
 boolean RAK410_XBeeWifiClass::isPresent() { // check if the device is present
@@ -71,19 +100,20 @@ boolean RAK410_XBeeWifiClass::restartWifi(const __FlashStringHelper* description
     Serial.println(")...");
   }
   c_isWifiPresent = false;
+  c_isCommandResponsePending = false;
+  resetReceiveState();
+  for (byte port = 0; port < WIFI_MAX_PORT_DESCRIPTORS; port++) {
+    removeQueuedRequests(port); // all connections are closed by reset
+  }
+  c_connectedPortsMask = 0;
+  c_keptPortsMask = 0;
 
   for (byte i = 0; i <= WI_FI_RECONNECT_ATTEMPTS_BEFORE_USE_DEFAULT_PARAMS; i++) { // Sometimes first command returns ERROR. We use two attempts
 
-    String input = wifiExecuteRawCommand(F("at+reset=0"), 500); // spec boot time 210   // NOresponse checked wrong
-
-    if (!StringUtils::flashStringEquals(input, FS(S_WIFI_RESPONSE_WELLCOME))) {
-      if (g_useSerialMonitor && input.length() > 0) {
-        showWifiMessage(F("Not correct welcome message: "), false);
-        PrintUtils::printWithoutCRLF(input);
-        Serial.print(F(" > "));
-        PrintUtils::printHEX(input);
-        Serial.println();
-      }
+    c_isWelcomeResponseExpected = true;
+    boolean isRestarted = wifiExecuteCommand(F("at+reset=0"), 500, false); // spec boot time 210
+    c_isWelcomeResponseExpected = false;
+    if (!isRestarted) {
       continue;
     }
 
@@ -176,21 +206,13 @@ boolean RAK410_XBeeWifiClass::checkStartedWifi() {
 
   showWifiMessage(F("Checking Wi-Fi status (stand by)..."));
   if (c_isLastWifiStationMode){
-    String input = wifiExecuteRawCommand(F("at+con_status"), 500); // Is Wi-Fi OK?
-
-    c_isWifiPresent = StringUtils::flashStringStartsWith(input, FS(S_WIFI_RESPONSE_OK));
+    c_isWifiPresent = wifiExecuteCommand(F("at+con_status"), 500, false); // Is Wi-Fi OK?
 
     if (c_isWifiPresent) {
       showWifiMessage(F("Wi-Fi connection OK"));
     }
     else {
-      if (g_useSerialMonitor) {
-        showWifiMessage(F("Wi-Fi connection LOST: "), false);
-        PrintUtils::printWithoutCRLF(input);
-        Serial.print(F(" > "));
-        PrintUtils::printHEX(input);
-        Serial.println();
-      }
+      showWifiMessage(F("Wi-Fi connection LOST"));
     }
   } else {
     showWifiMessage(F("Check skipped in Access Point mode"));
@@ -203,189 +225,565 @@ boolean RAK410_XBeeWifiClass::checkStartedWifi() {
 //                               HTTP                              //
 /////////////////////////////////////////////////////////////////////
 
-RAK410_XBeeWifiClass::RequestType RAK410_XBeeWifiClass::handleSerialEvent(byte &wifiPortDescriptor, String &input, String &getParams, String &postParams) {
+// Reads available bytes only, request is parsed by parts on next calls. Queued requests
+// are returned by turns of connected clients, next port after last served one goes first.
+// Returned views point to request buffer and stay valid till next call
+RAK410_XBeeWifiClass::RequestType RAK410_XBeeWifiClass::handleSerialEvent(byte &wifiPortDescriptor, char* &url, char* &getParams, char* &postParams, char* &ifNoneMatch, boolean &isGzipAccepted, boolean &isKeepAlive) {
 
-  //GB_Controller.updateBreeze(); // TODO make better.. see ArduinoPatch.cpp -> boolean Serial_timedRead(char* c)
+  for (byte i = 0; i < WIFI_REQUEST_QUEUE_SIZE; i++) {
+    if (c_requests[i].state == WIFI_REQUEST_STATE_SERVING) {
+      freeRequest(i);
+    }
+  }
 
   c_lastWifiActivityTimeStamp = now();
-
-  wifiPortDescriptor = 0xFF;
-  input = getParams = postParams = String();
-
-  input.reserve(100);
-  Serial_readString(input, 13); // "at+recv_data="
-
-  if (!StringUtils::flashStringEquals(input, F("at+recv_data="))) {
-    // Read data from serial manager
-    Serial_readString(input); // at first we should read, after manipulate  
-
-    if (StringUtils::flashStringStartsWith(input, FS(S_WIFI_RESPONSE_WELLCOME)) || StringUtils::flashStringStartsWith(input, FS(S_WIFI_RESPONSE_ERROR))) {
-      restartWifi(F("hardware"));
-      return RAK410_XBEEWIFI_REQUEST_TYPE_NONE;
+  receiveAvailableBytes();
+
+  byte foundIndex = WIFI_RECEIVE_NO_REQUEST;
+  byte foundDistance = WIFI_MAX_PORT_DESCRIPTORS;
+  byte foundAge = 0;
+  for (byte i = 0; i < WIFI_REQUEST_QUEUE_SIZE; i++) {
+    WifiRequest& request = c_requests[i];
+    if (request.state != WIFI_REQUEST_STATE_QUEUED) {
+      continue;
     }
-
-    if (g_useSerialMonitor) {
-      showWifiMessage(F("Receive unknown data: "), false);
-      PrintUtils::printWithoutCRLF(input);
-      Serial.print(F(" > "));
-      PrintUtils::printHEX(input);
-      Serial.println();
+    byte distance = (request.portDescriptor + WIFI_MAX_PORT_DESCRIPTORS - c_lastServedPortDescriptor - 1) % WIFI_MAX_PORT_DESCRIPTORS;
+    byte age = c_nextRequestNumber - request.number;
+    if (distance < foundDistance || (distance == foundDistance && age > foundAge)) {
+      foundIndex = i;
+      foundDistance = distance;
+      foundAge = age;
     }
-
+  }
+  if (foundIndex == WIFI_RECEIVE_NO_REQUEST) {
     return RAK410_XBEEWIFI_REQUEST_TYPE_NONE;
   }
-  else {
-    // WARNING! We need to do it quick. Standard serial buffer capacity only 64 bytes
-    Serial_readString(input, 1); // ends with '\r', cause '\n' will be removed
-    byte firstRequestHeaderByte = input[13]; //
 
-    if (firstRequestHeaderByte <= 0x07) {
-      // Data Received Successfully
-      wifiPortDescriptor = firstRequestHeaderByte;
+  WifiRequest& request = c_requests[foundIndex];
+  request.state = WIFI_REQUEST_STATE_SERVING;
+  wifiPortDescriptor = request.portDescriptor;
+  url = request.buffer;
+  getParams = request.buffer + request.queryOffset;
+  postParams = (c_postDataRequestIndex == foundIndex) ? c_postData : request.buffer + request.postDataOffset;
+  ifNoneMatch = (request.ifNoneMatchOffset == WIFI_REQUEST_NO_OFFSET) ? NULL : request.buffer + request.ifNoneMatchOffset;
+  isGzipAccepted = request.isGzipAccepted;
+  isKeepAlive = request.isKeepAlive;
+
+  c_lastServedPortDescriptor = wifiPortDescriptor;
+  return (RequestType) request.requestType;
+}
 
-      Serial_readString(input, 8);  // get full request header
+boolean RAK410_XBeeWifiClass::isRequestQueued() {
+  receiveAvailableBytes();
+  for (byte i = 0; i < WIFI_REQUEST_QUEUE_SIZE; i++) {
+    if (c_requests[i].state == WIFI_REQUEST_STATE_QUEUED) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// private:
 
-      byte lowByteDataLength = input[20];
-      byte highByteDataLength = input[21];
-      word dataLength = (((word)highByteDataLength) << 8) + lowByteDataLength;
+// Parses available bytes: requests are queued, command response is stored
+void RAK410_XBeeWifiClass::receiveAvailableBytes() {
+  if (c_receiveState != RECEIVE_STATE_COMMAND && (millis() - c_receiveMillis) > STREAM_TIMEOUT) {
+    showWifiMessage(F("Receive timeout, data skipped"));
+    resetReceiveState();
+  }
+  while (Serial1.available()) {
+    c_receiveMillis = millis();
+    handleSerialByte(Serial1.read());
+  }
+}
 
-      // Check HTTP type 
-      input = String();
-      input.reserve(100);
-      dataLength -= Serial_readStringUntil(input, dataLength, FS(S_CRLF));
+void RAK410_XBeeWifiClass::resetReceiveState() {
+  if (c_receiveRequestIndex != WIFI_RECEIVE_NO_REQUEST) {
+    freeRequest(c_receiveRequestIndex); // not completed
+  }
+  c_receiveState = RECEIVE_STATE_COMMAND;
+  c_receiveIndex = 0;
+  c_receiveRequestIndex = WIFI_RECEIVE_NO_REQUEST;
+}
 
-      boolean isGet = StringUtils::flashStringStartsWith(input, FS(S_WIFI_GET_));
-      boolean isPost = StringUtils::flashStringStartsWith(input, FS(S_WIFI_POST_));
+// Frame is "at+recv_data=" + header + data + "\r\n". Header is [P][6 bytes][LL][LH] for data, where P is
+// port descriptor, or [0x80|0x81][P][8 bytes] on client connect/disconnect, or [0xFF] on receive fail.
+// Data is tokenized in one pass: "METHOD /path?query HTTP/1.1\r\n" + headers + "\r\n\r\n" + post data
+void RAK410_XBeeWifiClass::handleSerialByte(char c) {
+  switch (c_receiveState) {
+
+  case RECEIVE_STATE_COMMAND:
+    if (c == (char) pgm_read_byte(S_WIFI_RECV_DATA + c_receiveIndex)) {
+      c_receiveIndex++;
+      if (pgm_read_byte(S_WIFI_RECV_DATA + c_receiveIndex) == 0x00) {
+        c_receiveState = RECEIVE_STATE_HEADER;
+        c_receiveIndex = 0;
+      }
+      break;
+    }
+    // Not a request, read message of Wi-Fi module. Matched part of command is kept
+    memcpy_P(c_receiveLine, S_WIFI_RECV_DATA, c_receiveIndex);
+    c_receiveState = RECEIVE_STATE_UNKNOWN;
+    handleSerialByte(c);
+    break;
 
-      if ((isGet || isPost) && StringUtils::flashStringEndsWith(input, FS(S_CRLF))) {
+  case RECEIVE_STATE_UNKNOWN:
+    c_receiveLine[c_receiveIndex++] = c;
+    if (c == '\n' || c_receiveIndex >= WIFI_RECEIVE_UNKNOWN_LINE_SIZE) {
+      handleUnknownLine();
+      resetReceiveState();
+    }
+    break;
 
-        int firstIndex;
-        if (isGet) {
-          firstIndex = StringUtils::flashStringLength(FS(S_WIFI_GET_)) - 1;
+  case RECEIVE_STATE_HEADER:
+    c_receiveHeader[c_receiveIndex++] = c;
+    if (c_receiveHeader[0] <= 0x07) {
+      // Data Received Successfully
+      if (c_receiveIndex == WIFI_RECEIVE_DATA_HEADER_SIZE) {
+        c_receivePortDescriptor = c_receiveHeader[0];
+        c_receiveDataLength = makeWord(c_receiveHeader[8], c_receiveHeader[7]);
+        c_receiveIndex = 0;
+        if (c_receiveDataLength == 0) {
+          startReceiveSkip(2); // end mark
         }
         else {
-          firstIndex = StringUtils::flashStringLength(FS(S_WIFI_POST_)) - 1;
+          startReceiveRequest();
         }
-        int lastIndex = input.indexOf(' ', firstIndex);
-        if (lastIndex == -1) {
-          lastIndex = input.length() - 2; // \r\n
+      }
+    }
+    else if (c_receiveHeader[0] == 0x80 || c_receiveHeader[0] == 0x81) {
+      // TCP client connected or disconnected
+      if (c_receiveIndex == WIFI_RECEIVE_CONNECTION_HEADER_SIZE) {
+        c_receivePortDescriptor = c_receiveHeader[1];
+        boolean isConnected = (c_receiveHeader[0] == 0x80);
+        if (c_receivePortDescriptor < WIFI_MAX_PORT_DESCRIPTORS) {
+          if (isConnected) {
+            bitSet(c_connectedPortsMask, c_receivePortDescriptor);
+          }
+          else {
+            bitClear(c_connectedPortsMask, c_receivePortDescriptor);
+            removeQueuedRequests(c_receivePortDescriptor);
+            removeKeptConnection(c_receivePortDescriptor);
+          }
         }
-        input = input.substring(firstIndex, lastIndex);
-
-        int indexOfQuestion = input.indexOf('?');
-        if (indexOfQuestion != -1) {
-          getParams = input.substring(indexOfQuestion + 1);
-          input = input.substring(0, indexOfQuestion);
+        if (g_useSerialMonitor) {
+          showWifiMessage(isConnected ? FS(S_Connected) : FS(S_Disconnected), false);
+          Serial.print(' ');
+          Serial.println(c_receivePortDescriptor);
         }
+        resetReceiveState();
+      }
+    }
+    else if (c_receiveHeader[0] == 0xFF) {
+      // Data received Failed
+      startReceiveSkip(2); // end mark
+    }
+    else {
+      // Unknown packet and it size, skipped till timeout
+      startReceiveSkip(0xFFFF);
+    }
+    break;
 
-        if (isGet) {
-          // We are not interested in this information
-          Serial_skipBytes(dataLength);
-          Serial_skipBytes(2); // remove end mark 
-
-          if (g_useSerialMonitor) {
-            showWifiMessage(F("Receive from ["), false);
-            Serial.print(wifiPortDescriptor);
-            Serial.print(F("] GET ["));
-            Serial.print(input);
-            Serial.print(F("], getParams ["));
-            Serial.print(getParams);
-            Serial.println(']');
-          }
+  case RECEIVE_STATE_HTTP_METHOD:
+    c_receiveDataLength--;
+    if (c == ' ') {
+      WifiRequest& request = c_requests[c_receiveRequestIndex];
+      appendReceivedChar(0x00);
+      if (strcmp_P(request.buffer, S_WIFI_GET) == 0) {
+        request.requestType = RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_GET;
+      }
+      else if (strcmp_P(request.buffer, S_WIFI_POST) == 0) {
+        request.requestType = RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_POST;
+      }
+      else {
+        handleUnknownHttpRequest(F("unknown method"));
+        break;
+      }
+      request.length = 0; // method is not needed anymore
+      c_receiveState = RECEIVE_STATE_HTTP_PATH;
+      if (c_receiveDataLength == 0) {
+        handleUnknownHttpRequest(F("no request line"));
+      }
+    }
+    else if (c_receiveIndex++ >= 4 || !appendReceivedChar(c)) { // "POST" is longest
+      handleUnknownHttpRequest(F("unknown method"));
+    }
+    else if (c_receiveDataLength == 0) {
+      handleUnknownHttpRequest(F("no request line"));
+    }
+    break;
 
-          return RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_GET;
-        }
-        else {
-          // Post
-          //word dataLength0 = dataLength;
-          dataLength -= Serial_skipBytesUntil(dataLength, FS(S_CRLFCRLF)); // skip HTTP header
-          //word dataLength1 = dataLength;
-          dataLength -= Serial_readStringUntil(postParams, dataLength, FS(S_CRLF)); // read HTTP data;
-          // word dataLength2 = dataLength;           
-          Serial_skipBytes(dataLength); // skip remained endings
-
-          if (StringUtils::flashStringEndsWith(postParams, FS(S_CRLF))) {
-            postParams = postParams.substring(0, input.length() - 2);
-          }
+  case RECEIVE_STATE_HTTP_PATH:
+  case RECEIVE_STATE_HTTP_QUERY:
+    c_receiveDataLength--;
+    if (c == ' ' || c == '\r' || c == '\n') {
+      WifiRequest& request = c_requests[c_receiveRequestIndex];
+      if (c_receiveState == RECEIVE_STATE_HTTP_PATH) {
+        appendReceivedChar(0x00);
+        request.queryOffset = request.length; // no query
+      }
+      if (!appendReceivedChar(0x00)) {
+        handleUnknownHttpRequest(F("too long"), RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_TOO_LARGE);
+      }
+      else if (c == '\n') {
+        request.isKeepAlive = false; // no protocol version
+        completeHttpRequestLine();
+      }
+      else if (c_receiveDataLength == 0) {
+        handleUnknownHttpRequest(F("no request line end"));
+      }
+      else {
+        c_receiveState = RECEIVE_STATE_HTTP_REQUEST_LINE;
+      }
+    }
+    else if (c == '?' && c_receiveState == RECEIVE_STATE_HTTP_PATH) {
+      if (!appendReceivedChar(0x00)) {
+        handleUnknownHttpRequest(F("too long"), RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_TOO_LARGE);
+        break;
+      }
+      c_requests[c_receiveRequestIndex].queryOffset = c_requests[c_receiveRequestIndex].length;
+      c_receiveState = RECEIVE_STATE_HTTP_QUERY;
+      if (c_receiveDataLength == 0) {
+        handleUnknownHttpRequest(F("no request line end"));
+      }
+    }
+    else if (!appendReceivedChar(c)) {
+      handleUnknownHttpRequest(F("too long"), RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_TOO_LARGE);
+    }
+    else if (c_receiveDataLength == 0) {
+      handleUnknownHttpRequest(F("no request line end"));
+    }
+    break;
 
-          Serial_skipBytes(2); // remove end mark 
-
-          if (g_useSerialMonitor) {
-            showWifiMessage(F("Recive from ["), false);
-            Serial.print(wifiPortDescriptor);
-            Serial.print(F("] POST ["));
-            Serial.print(input);
-            Serial.print(F("], getParams ["));
-            Serial.print(getParams);
-            Serial.print(F("], postParams ["));
-            Serial.print(postParams);
-            Serial.println(']');
-          }
+  case RECEIVE_STATE_HTTP_REQUEST_LINE:
+    c_receiveDataLength--;
+    if (c == '0') { // "HTTP/1.0" closes connection by default
+      c_requests[c_receiveRequestIndex].isKeepAlive = false;
+    }
+    if (c == '\n') {
+      completeHttpRequestLine();
+    }
+    else if (c_receiveDataLength == 0) {
+      handleUnknownHttpRequest(F("no request line end"));
+    }
+    break;
 
-          return RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_POST;
-        }
+  case RECEIVE_STATE_HTTP_HEADERS:
+    c_receiveDataLength--;
+    if (c == (char) pgm_read_byte(S_CRLFCRLF + c_receiveIndex)) {
+      c_receiveIndex++;
+    }
+    else {
+      c_receiveIndex = (c == '\r') ? 1 : 0;
+    }
+    if (!receiveHttpHeaderChar(c)) {
+      handleUnknownHttpRequest(F("too long"), RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_TOO_LARGE);
+    }
+    else if (c_receiveIndex == 4 || c_receiveDataLength == 0) {
+      completeHttpHeaders();
+    }
+    break;
+
+  case RECEIVE_STATE_HTTP_POST_DATA:
+    c_receiveDataLength--;
+    if (c == '\r' || c == '\n') {
+      if (!appendPostDataChar(0x00)) {
+        handleUnknownHttpRequest(F("too long"), RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_TOO_LARGE);
+        break;
       }
-      else {
-        // Unknown HTTP request type
-        Serial_skipBytes(dataLength); // remove all data
-        Serial_skipBytes(2); // remove end mark 
-        if (g_useSerialMonitor) {
-          showWifiMessage(F("Receive from ["), false);
-          Serial.print(wifiPortDescriptor);
-          Serial.print(F("] unknown HTTP ["));
-          PrintUtils::printWithoutCRLF(input);
-          Serial.print(F("] -> ["));
-          PrintUtils::printHEX(input);
-          Serial.println(']');
-        }
+      startReceiveSkip(c_receiveDataLength + 2); // skip remained endings and end mark
+    }
+    else if (!appendPostDataChar(c) || (c_receiveDataLength == 0 && !appendPostDataChar(0x00))) {
+      handleUnknownHttpRequest(F("too long"), RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_TOO_LARGE);
+    }
+    else if (c_receiveDataLength == 0) {
+      startReceiveSkip(2);
+    }
+    break;
 
-        return RAK410_XBEEWIFI_REQUEST_TYPE_NONE;
+  case RECEIVE_STATE_SKIP:
+    c_receiveDataLength--;
+    if (c_receiveDataLength == 0) {
+      if (c_receiveRequestIndex != WIFI_RECEIVE_NO_REQUEST) {
+        queueRequest();
       }
+      resetReceiveState();
+    }
+    break;
+  }
+}
 
+void RAK410_XBeeWifiClass::completeHttpRequestLine() {
+  c_receiveHttpHeader = RECEIVE_HTTP_HEADER_NAME;
+  c_receiveHeaderIndex = 0;
+  if (c_receiveDataLength == 0) {
+    completeHttpHeaders();
+  }
+  else {
+    c_receiveState = RECEIVE_STATE_HTTP_HEADERS;
+    c_receiveIndex = 2; // request line CRLF is matched already
+  }
+}
+
+// Header names are matched char by char. Value of If-None-Match is appended to request buffer,
+// Accept-Encoding is checked for gzip, Connection for close. Returns false, if request buffer is full
+boolean RAK410_XBeeWifiClass::receiveHttpHeaderChar(char c) {
+  WifiRequest& request = c_requests[c_receiveRequestIndex];
+  if (c == '\n') {
+    boolean isValueCompleted = (c_receiveHttpHeader == RECEIVE_HTTP_HEADER_IF_NONE_MATCH_VALUE);
+    c_receiveHttpHeader = RECEIVE_HTTP_HEADER_NAME;
+    c_receiveHeaderIndex = 0;
+    if (isValueCompleted) {
+      return appendReceivedChar(0x00);
     }
-    else if (firstRequestHeaderByte == 0x80) {
-      // TCP client connected
-      Serial_readString(input, 1);
-      wifiPortDescriptor = input[14];
-      Serial_skipBytes(8);
+    return true;
+  }
 
-      if (g_useSerialMonitor) {
-        showWifiMessage(FS(S_Connected), false);
-        Serial.print(' ');
-        Serial.println(wifiPortDescriptor);
+  char lowerC = tolower(c);
+  if (c_receiveHttpHeader == RECEIVE_HTTP_HEADER_NAME) {
+    if (lowerC == 'i') {
+      c_receiveHttpHeader = RECEIVE_HTTP_HEADER_IF_NONE_MATCH;
+    }
+    else if (lowerC == 'a') {
+      c_receiveHttpHeader = RECEIVE_HTTP_HEADER_ACCEPT_ENCODING;
+    }
+    else if (lowerC == 'c') {
+      c_receiveHttpHeader = RECEIVE_HTTP_HEADER_CONNECTION;
+    }
+    else {
+      c_receiveHttpHeader = RECEIVE_HTTP_HEADER_SKIP;
+    }
+  }
+
+  if (c_receiveHttpHeader == RECEIVE_HTTP_HEADER_IF_NONE_MATCH || c_receiveHttpHeader == RECEIVE_HTTP_HEADER_ACCEPT_ENCODING || c_receiveHttpHeader == RECEIVE_HTTP_HEADER_CONNECTION) {
+    PGM_P name = (c_receiveHttpHeader == RECEIVE_HTTP_HEADER_IF_NONE_MATCH) ? S_WIFI_IF_NONE_MATCH :
+        (c_receiveHttpHeader == RECEIVE_HTTP_HEADER_ACCEPT_ENCODING) ? S_WIFI_ACCEPT_ENCODING : S_WIFI_CONNECTION;
+    if (lowerC != (char) pgm_read_byte(name + c_receiveHeaderIndex)) {
+      c_receiveHttpHeader = RECEIVE_HTTP_HEADER_SKIP;
+    }
+    else if (pgm_read_byte(name + (++c_receiveHeaderIndex)) == 0x00) {
+      c_receiveHeaderIndex = 0;
+      if (c_receiveHttpHeader == RECEIVE_HTTP_HEADER_IF_NONE_MATCH) {
+        c_receiveHttpHeader = RECEIVE_HTTP_HEADER_IF_NONE_MATCH_VALUE;
+        request.ifNoneMatchOffset = request.length;
+      }
+      else if (c_receiveHttpHeader == RECEIVE_HTTP_HEADER_ACCEPT_ENCODING) {
+        c_receiveHttpHeader = RECEIVE_HTTP_HEADER_ACCEPT_ENCODING_VALUE;
+      }
+      else {
+        c_receiveHttpHeader = RECEIVE_HTTP_HEADER_CONNECTION_VALUE;
       }
+    }
+  }
+  else if (c_receiveHttpHeader == RECEIVE_HTTP_HEADER_IF_NONE_MATCH_VALUE) {
+    if (c == '\r' || (c == ' ' && request.length == request.ifNoneMatchOffset)) {
+      return true;
+    }
+    if (request.length - request.ifNoneMatchOffset >= WIFI_REQUEST_IF_NONE_MATCH_SIZE) {
+      request.length = request.ifNoneMatchOffset; // not our tag
+      request.ifNoneMatchOffset = WIFI_REQUEST_NO_OFFSET;
+      c_receiveHttpHeader = RECEIVE_HTTP_HEADER_SKIP;
+      return true;
+    }
+    return appendReceivedChar(c);
+  }
+  else if (c_receiveHttpHeader == RECEIVE_HTTP_HEADER_ACCEPT_ENCODING_VALUE || c_receiveHttpHeader == RECEIVE_HTTP_HEADER_CONNECTION_VALUE) {
+    // "gzip" and "close" have no repeated chars, mismatch restarts search
+    PGM_P searched = (c_receiveHttpHeader == RECEIVE_HTTP_HEADER_ACCEPT_ENCODING_VALUE) ? S_WIFI_GZIP : S_WIFI_CLOSE;
+    if (lowerC != (char) pgm_read_byte(searched + c_receiveHeaderIndex)) {
+      c_receiveHeaderIndex = (lowerC == (char) pgm_read_byte(searched)) ? 1 : 0;
+    }
+    else if (pgm_read_byte(searched + (++c_receiveHeaderIndex)) == 0x00) {
+      if (c_receiveHttpHeader == RECEIVE_HTTP_HEADER_ACCEPT_ENCODING_VALUE) {
+        request.isGzipAccepted = true;
+      }
+      else {
+        request.isKeepAlive = false;
+      }
+      c_receiveHttpHeader = RECEIVE_HTTP_HEADER_SKIP;
+    }
+  }
+  return true;
+}
 
-      return RAK410_XBEEWIFI_REQUEST_TYPE_CLIENT_CONNECTED;
+void RAK410_XBeeWifiClass::completeHttpHeaders() {
+  WifiRequest& request = c_requests[c_receiveRequestIndex];
+  if (c_receiveHttpHeader == RECEIVE_HTTP_HEADER_IF_NONE_MATCH_VALUE && !appendReceivedChar(0x00)) { // frame ends in header line
+    handleUnknownHttpRequest(F("too long"), RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_TOO_LARGE);
+    return;
+  }
+  request.postDataOffset = request.length;
+  if (request.requestType == RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_POST && c_receiveDataLength > 0) {
+    if (c_postDataRequestIndex != WIFI_RECEIVE_NO_REQUEST) {
+      handleUnknownHttpRequest(F("post data buffer is busy"), RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_BUSY);
+      return;
+    }
+    c_postDataRequestIndex = c_receiveRequestIndex;
+    c_postDataLength = 0;
+    c_receiveState = RECEIVE_STATE_HTTP_POST_DATA;
+  }
+  else if (!appendReceivedChar(0x00)) { // no post data
+    handleUnknownHttpRequest(F("too long"), RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_TOO_LARGE);
+  }
+  else {
+    startReceiveSkip(c_receiveDataLength + 2); // GET body is not used
+  }
+}
 
+void RAK410_XBeeWifiClass::startReceiveRequest() {
+  for (byte i = 0; i < WIFI_REQUEST_QUEUE_SIZE; i++) {
+    WifiRequest& request = c_requests[i];
+    if (request.state != WIFI_REQUEST_STATE_FREE) {
+      continue;
     }
-    else if (firstRequestHeaderByte == 0x81) {
-      // TCP client disconnected
-      Serial_readString(input, 1);
-      wifiPortDescriptor = input[14];
-      Serial_skipBytes(8);
+    request.state = WIFI_REQUEST_STATE_RECEIVING;
+    request.portDescriptor = c_receivePortDescriptor;
+    request.requestType = RAK410_XBEEWIFI_REQUEST_TYPE_NONE;
+    request.queryOffset = request.postDataOffset = request.length = 0;
+    request.ifNoneMatchOffset = WIFI_REQUEST_NO_OFFSET;
+    request.isGzipAccepted = false;
+    request.isKeepAlive = true;
+    c_receiveRequestIndex = i;
+    removeKeptConnection(c_receivePortDescriptor); // not idle anymore
+    c_receiveState = RECEIVE_STATE_HTTP_METHOD;
+    return;
+  }
+  if (g_useSerialMonitor) {
+    showWifiMessage(F("Request queue is full, request from ["), false);
+    Serial.print(c_receivePortDescriptor);
+    Serial.println(F("] skipped"));
+  }
+  startReceiveSkip(c_receiveDataLength + 2);
+}
 
-      if (g_useSerialMonitor) {
-        showWifiMessage(FS(S_Disconnected), false);
-        Serial.print(' ');
-        Serial.println(wifiPortDescriptor);
-      }
+// Returns false, if request buffer is full
+boolean RAK410_XBeeWifiClass::appendReceivedChar(char c) {
+  WifiRequest& request = c_requests[c_receiveRequestIndex];
+  if (request.length >= WIFI_REQUEST_BUFFER_SIZE) {
+    return false;
+  }
+  request.buffer[request.length++] = c;
+  return true;
+}
 
-      return RAK410_XBEEWIFI_REQUEST_TYPE_CLIENT_DISCONNECTED;
+// Returns false, if post data buffer is full
+boolean RAK410_XBeeWifiClass::appendPostDataChar(char c) {
+  if (c_postDataLength >= WIFI_REQUEST_POST_DATA_SIZE) {
+    return false;
+  }
+  c_postData[c_postDataLength++] = c;
+  return true;
+}
 
+void RAK410_XBeeWifiClass::freeRequest(byte index) {
+  c_requests[index].state = WIFI_REQUEST_STATE_FREE;
+  if (c_postDataRequestIndex == index) {
+    c_postDataRequestIndex = WIFI_RECEIVE_NO_REQUEST;
+  }
+}
+
+void RAK410_XBeeWifiClass::queueRequest() {
+  byte index = c_receiveRequestIndex;
+  WifiRequest& request = c_requests[index];
+  request.state = WIFI_REQUEST_STATE_QUEUED;
+  request.number = c_nextRequestNumber++;
+  c_receiveRequestIndex = WIFI_RECEIVE_NO_REQUEST;
+
+  if (g_useSerialMonitor && (request.requestType == RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_GET || request.requestType == RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_POST)) {
+    showWifiMessage(F("Receive from ["), false);
+    Serial.print(request.portDescriptor);
+    Serial.print((request.requestType == RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_GET) ? F("] GET [") : F("] POST ["));
+    Serial.print(request.buffer);
+    Serial.print(F("], getParams ["));
+    Serial.print(request.buffer + request.queryOffset);
+    if (request.requestType == RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_POST) {
+      Serial.print(F("], postParams ["));
+      Serial.print((c_postDataRequestIndex == index) ? c_postData : request.buffer + request.postDataOffset);
     }
-    else if (firstRequestHeaderByte == 0xFF) {
-      // Data received Failed
-      Serial_skipBytes(2); // remove end mark and exit quick
-      return RAK410_XBEEWIFI_REQUEST_TYPE_NONE;
+    Serial.println(']');
+  }
+}
 
+// Requests of disconnected client are not served
+void RAK410_XBeeWifiClass::removeQueuedRequests(byte portDescriptor) {
+  for (byte i = 0; i < WIFI_REQUEST_QUEUE_SIZE; i++) {
+    if (c_requests[i].state == WIFI_REQUEST_STATE_QUEUED && c_requests[i].portDescriptor == portDescriptor) {
+      freeRequest(i);
     }
-    else {
-      // Unknown packet and it size
-      Serial_skipAll();
-      return RAK410_XBEEWIFI_REQUEST_TYPE_NONE;
+  }
+}
+
+void RAK410_XBeeWifiClass::removeKeptConnection(byte portDescriptor) {
+  if (portDescriptor < WIFI_MAX_PORT_DESCRIPTORS) {
+    bitClear(c_keptPortsMask, portDescriptor);
+  }
+}
+
+void RAK410_XBeeWifiClass::startReceiveSkip(word length) {
+  c_receiveState = RECEIVE_STATE_SKIP;
+  c_receiveDataLength = length;
+}
+
+void RAK410_XBeeWifiClass::handleUnknownLine() {
+  if (c_isCommandResponsePending) {
+    boolean isOK = StringUtils::flashStringStartsWith(c_receiveLine, c_receiveIndex, c_isWelcomeResponseExpected ? FS(S_WIFI_RESPONSE_WELLCOME) : FS(S_WIFI_RESPONSE_OK));
+    if (isOK || StringUtils::flashStringStartsWith(c_receiveLine, c_receiveIndex, FS(S_WIFI_RESPONSE_ERROR))) {
+      c_isCommandResponsePending = false;
+      c_isCommandResponseOK = isOK;
+      if (isOK) {
+        c_lastWifiActivityTimeStamp = now();
+      }
+      else if (g_useSerialMonitor) {
+        showWifiMessage(F("Command failed: "), false);
+        PrintUtils::printWithoutCRLF(c_receiveLine, c_receiveIndex);
+        Serial.print(F(" > "));
+        PrintUtils::printHEX(c_receiveLine, c_receiveIndex);
+        Serial.println();
+      }
+      return;
     }
   }
-  return RAK410_XBEEWIFI_REQUEST_TYPE_NONE;
+
+  if (StringUtils::flashStringStartsWith(c_receiveLine, c_receiveIndex, FS(S_WIFI_RESPONSE_WELLCOME)) || StringUtils::flashStringStartsWith(c_receiveLine, c_receiveIndex, FS(S_WIFI_RESPONSE_ERROR))) {
+    c_isCommandResponsePending = false;
+    c_isCommandResponseOK = false;
+    c_restartWifiOnNextUpdate = true; // not now, bytes can be received inside of sending
+    showWifiMessage(F("Hardware restart detected"));
+    return;
+  }
+
+  if (g_useSerialMonitor) {
+    showWifiMessage(F("Receive unknown data: "), false);
+    PrintUtils::printWithoutCRLF(c_receiveLine, c_receiveIndex);
+    Serial.print(F(" > "));
+    PrintUtils::printHEX(c_receiveLine, c_receiveIndex);
+    Serial.println();
+  }
+}
+
+// Rest of frame is skipped, then request is queued with error type to be answered
+void RAK410_XBeeWifiClass::handleUnknownHttpRequest(const __FlashStringHelper* description, RequestType errorType) {
+  WifiRequest& request = c_requests[c_receiveRequestIndex];
+  if (g_useSerialMonitor) {
+    showWifiMessage(F("Receive from ["), false);
+    Serial.print(c_receivePortDescriptor);
+    Serial.print(F("] wrong HTTP request, "));
+    Serial.print(description);
+    Serial.print(F(" ["));
+    PrintUtils::printWithoutCRLF(request.buffer, request.length);
+    Serial.print(F("] -> ["));
+    PrintUtils::printHEX(request.buffer, request.length);
+    Serial.println(']');
+  }
+  if (c_postDataRequestIndex == c_receiveRequestIndex) {
+    c_postDataRequestIndex = WIFI_RECEIVE_NO_REQUEST;
+  }
+  request.requestType = errorType;
+  request.queryOffset = request.postDataOffset = request.length = 0;
+  request.ifNoneMatchOffset = WIFI_REQUEST_NO_OFFSET;
+  request.isKeepAlive = false;
+  request.buffer[0] = 0x00; // empty url, query and post data
+  startReceiveSkip(c_receiveDataLength + 2); // remove all data and end mark
 }
 
 void RAK410_XBeeWifiClass::sendFixedSizeData(const byte portDescriptor, const __FlashStringHelper* data) { // INT_MAX (own test) or 1400 bytes max (Wi-Fi spec restriction)
@@ -399,6 +797,7 @@ void RAK410_XBeeWifiClass::sendFixedSizeData(const byte portDescriptor, const __
 }
 
 void RAK410_XBeeWifiClass::sendFixedSizeFrameStart(const byte portDescriptor, word length) { // 1400 bytes max (Wi-Fi module spec restriction)
+  waitCommandResponse(); // previous frame
   wifiExecuteCommandPrint(F("at+send_data="));
   wifiExecuteCommandPrint(portDescriptor);
   wifiExecuteCommandPrint(',');
@@ -420,8 +819,16 @@ void RAK410_XBeeWifiClass::sendFixedSizeFrameData(const String &data) {
   wifiExecuteCommandPrint(data);
 }
 
+void RAK410_XBeeWifiClass::sendFixedSizeFrameData(const char* data) {
+
+  GB_Controller.updateBreeze();
+
+  wifiExecuteCommandPrint(data);
+}
+
 boolean RAK410_XBeeWifiClass::sendFixedSizeFrameStop() {
-  return wifiExecuteCommand(NULL, WIFI_RESPONSE_DEFAULT_DELAY, false); // maybe client disconnected, do not reboot
+  sendCommandEnd();
+  return waitCommandResponse(); // maybe client disconnected, do not reboot
 }
 
 void RAK410_XBeeWifiClass::sendAutoSizeFrameStart(const byte &wifiPortDescriptor) {
@@ -436,58 +843,71 @@ void RAK410_XBeeWifiClass::sendAutoSizeFrameStart(const byte &wifiPortDescriptor
 #endif
 
   c_autoSizeFrameSize = 0;
+  c_isAutoSizeFrameFailed = false; // frame is restarted inside of response only after sent one
 }
 
 boolean RAK410_XBeeWifiClass::sendAutoSizeFrameData(const byte &wifiPortDescriptor, const __FlashStringHelper* data) {
-  return RAK410_XBeeWifiClass::sendAutoSizeFrameData(wifiPortDescriptor, StringUtils::flashStringLoad(data));
+  return sendAutoSizeFrameData(wifiPortDescriptor, reinterpret_cast<PGM_P>(data), StringUtils::flashStringLength(data), true);
 }
 
-boolean RAK410_XBeeWifiClass::sendAutoSizeFrameData(const byte &wifiPortDescriptor, const String &data) {
+// Data is copied to frame by chunks, full frame is sent and next one is started
+boolean RAK410_XBeeWifiClass::sendAutoSizeFrameData(const byte &wifiPortDescriptor, const char* data, word length, boolean isProgMem) {
 
   GB_Controller.updateBreeze();
-
-  if (data.length() == 0) {
-    return true;
+  readCommandResponse();
+  if (c_isAutoSizeFrameFailed) {
+    return false;
   }
 
-  if (c_autoSizeFrameSize + data.length() < WIFI_MAX_SEND_FRAME_SIZE) {
+  while (length > 0) {
+    word frameCapacity = WIFI_MAX_SEND_FRAME_SIZE;
+    if (c_autoSizeFrameChunkStart != WIFI_NO_CHUNK) {
+      frameCapacity -= WIFI_CHUNK_OVERHEAD;
+    }
+    if (c_autoSizeFrameSize >= frameCapacity) {
+      if (!sendAutoSizeFrameStop(wifiPortDescriptor)) {
+        return false;
+      }
+      sendAutoSizeFrameStart(wifiPortDescriptor);
+    }
+    word chunkLength = frameCapacity - c_autoSizeFrameSize;
+    if (chunkLength > length) {
+      chunkLength = length;
+    }
 #ifdef WIFI_USE_FIXED_SIZE_SUB_FAMES_IN_AUTO_SIZE_FRAME
-    c_autoSizeFrameSize += wifiExecuteCommandPrint(data, WIFI_SHOW_AUTO_SIZE_FRAME_DATA);
-#else  
-    for (unsigned int i = 0; i < data.length(); i++) {
-      c_autoSizeFrameBuffer[c_autoSizeFrameSize++] = data[i];
+    for (word i = 0; i < chunkLength; i++) {
+      char c = isProgMem ? pgm_read_byte(data + i) : data[i];
+      c_autoSizeFrameSize += wifiExecuteCommandPrint(c, WIFI_SHOW_AUTO_SIZE_FRAME_DATA);
+    }
+#else
+    if (isProgMem) {
+      memcpy_P(c_autoSizeFrameBuffer + c_autoSizeFrameSize, data, chunkLength);
+    }
+    else {
+      memcpy(c_autoSizeFrameBuffer + c_autoSizeFrameSize, data, chunkLength);
     }
+    c_autoSizeFrameSize += chunkLength;
 #endif
-    return true;
+    data += chunkLength;
+    length -= chunkLength;
   }
 
-  size_t index = 0;
-  while (c_autoSizeFrameSize < WIFI_MAX_SEND_FRAME_SIZE) {
-    char c = data[index++];
-#ifdef WIFI_USE_FIXED_SIZE_SUB_FAMES_IN_AUTO_SIZE_FRAME
-    c_autoSizeFrameSize += wifiExecuteCommandPrint(c, WIFI_SHOW_AUTO_SIZE_FRAME_DATA);
-#else  
-    c_autoSizeFrameBuffer[c_autoSizeFrameSize++] = c;
-#endif
-  }
-  if (!sendAutoSizeFrameStop(wifiPortDescriptor)) {
-    return false;
-  }
-  sendAutoSizeFrameStart(wifiPortDescriptor);
+  return true;
+}
 
-  while (index < data.length()) {
-    char c = data[index++];
-#ifdef WIFI_USE_FIXED_SIZE_SUB_FAMES_IN_AUTO_SIZE_FRAME
-    c_autoSizeFrameSize += wifiExecuteCommandPrint(c, WIFI_SHOW_AUTO_SIZE_FRAME_DATA);
-#else  
-    c_autoSizeFrameBuffer[c_autoSizeFrameSize++] = c;
-#endif  
+// Data appended after call is sent by chunks of HTTP chunked transfer encoding, one chunk per frame.
+// Data before it in current frame (HTTP header) is sent as is. Last frame completes chunked data
+void RAK410_XBeeWifiClass::sendAutoSizeFrameChunksStart() {
+  if (WIFI_IS_CHUNKED_TRANSFER_SUPPORTED) {
+    c_autoSizeFrameChunkStart = c_autoSizeFrameSize;
   }
-
-  return true;
 }
 
-boolean RAK410_XBeeWifiClass::sendAutoSizeFrameStop(const byte &wifiPortDescriptor) {
+// After failed frame all data of response is dropped, client can't get consistent rest of it
+boolean RAK410_XBeeWifiClass::sendAutoSizeFrameStop(const byte &wifiPortDescriptor, boolean isLastFrame) {
+  if (c_isAutoSizeFrameFailed) {
+    return false;
+  }
 
 #ifdef WIFI_USE_FIXED_SIZE_SUB_FAMES_IN_AUTO_SIZE_FRAME
 
@@ -496,81 +916,125 @@ boolean RAK410_XBeeWifiClass::sendAutoSizeFrameStop(const byte &wifiPortDescript
       c_autoSizeFrameSize += Serial1.write(0x00); // Filler 0x00
     }
   }
-  return sendFixedSizeFrameStop();
+  c_isAutoSizeFrameFailed = !sendFixedSizeFrameStop();
+  return !c_isAutoSizeFrameFailed;
 
 #else
-  if (c_autoSizeFrameSize == 0) {
+  boolean isChunked = (c_autoSizeFrameChunkStart != WIFI_NO_CHUNK);
+  word chunkStart = isChunked ? c_autoSizeFrameChunkStart : c_autoSizeFrameSize;
+  word chunkSize = c_autoSizeFrameSize - chunkStart;
+  boolean isLastChunk = (isChunked && isLastFrame);
+  c_autoSizeFrameChunkStart = (isChunked && !isLastFrame) ? 0 : WIFI_NO_CHUNK; // next frame is chunk only
+
+  word frameSize = c_autoSizeFrameSize;
+  if (chunkSize > 0) {
+    frameSize += WIFI_CHUNK_SIZE_DIGITS + 4;
+  }
+  if (isLastChunk) {
+    frameSize += StringUtils::flashStringLength(F("0\r\n\r\n"));
+  }
+  if (frameSize == 0) {
     return true;
   }
-  sendFixedSizeFrameStart(wifiPortDescriptor, c_autoSizeFrameSize);
+  if (!waitCommandResponse()) { // previous frame
+    c_autoSizeFrameSize = 0;
+    c_autoSizeFrameChunkStart = WIFI_NO_CHUNK;
+    c_isAutoSizeFrameFailed = true;
+    return false;
+  }
+  sendFixedSizeFrameStart(wifiPortDescriptor, frameSize);
   if (!WIFI_SHOW_AUTO_SIZE_FRAME_DATA) {
     Serial.print(F("[...]"));
   }
-  for (word i = 0; i < c_autoSizeFrameSize; i++) {
+  for (word i = 0; i < chunkStart; i++) {
     wifiExecuteCommandPrint(c_autoSizeFrameBuffer[i], WIFI_SHOW_AUTO_SIZE_FRAME_DATA);
   }
+  if (chunkSize > 0) {
+    for (byte i = WIFI_CHUNK_SIZE_DIGITS; i > 0; i--) { // leading zeros are allowed
+      byte digit = (chunkSize >> (4 * (i - 1))) & 0x0F;
+      wifiExecuteCommandPrint((char) ((digit < 10) ? ('0' + digit) : ('A' + digit - 10)), WIFI_SHOW_AUTO_SIZE_FRAME_DATA);
+    }
+    wifiExecuteCommandPrint(FS(S_CRLF), WIFI_SHOW_AUTO_SIZE_FRAME_DATA);
+    for (word i = chunkStart; i < c_autoSizeFrameSize; i++) {
+      wifiExecuteCommandPrint(c_autoSizeFrameBuffer[i], WIFI_SHOW_AUTO_SIZE_FRAME_DATA);
+    }
+    wifiExecuteCommandPrint(FS(S_CRLF), WIFI_SHOW_AUTO_SIZE_FRAME_DATA);
+  }
+  if (isLastChunk) {
+    wifiExecuteCommandPrint(F("0\r\n\r\n"), WIFI_SHOW_AUTO_SIZE_FRAME_DATA);
+  }
   c_autoSizeFrameSize = 0;
-  return sendFixedSizeFrameStop();
+  sendCommandEnd(); // response is checked before next frame or command
+  return true;
 #endif
 
 }
 
 boolean RAK410_XBeeWifiClass::sendCloseConnection(const byte wifiPortDescriptor) {
+  waitCommandResponse(); // previous frame
+  removeKeptConnection(wifiPortDescriptor);
   wifiExecuteCommandPrint(F("at+cls="));
   wifiExecuteCommandPrint(wifiPortDescriptor);
-  return wifiExecuteCommand(NULL, WIFI_RESPONSE_DEFAULT_DELAY, false);
+  sendCommandEnd();
+  return waitCommandResponse(); // requests of other clients are queued meanwhile
 }
 
-//private:
-
-boolean RAK410_XBeeWifiClass::wifiExecuteCommand(const __FlashStringHelper* command, size_t maxResponseDeleay, boolean rebootIfNoResponse) {
-  String input = wifiExecuteRawCommand(command, maxResponseDeleay);
-  if (StringUtils::flashStringStartsWith(input, FS(S_WIFI_RESPONSE_OK)) && StringUtils::flashStringEndsWith(input, FS(S_CRLF))) {
-    c_lastWifiActivityTimeStamp = now();
-    return true;
+// Response is completed and delimited by length, client sends next request over same connection.
+// Connection is closed and false is returned, if last frame of response was not sent
+boolean RAK410_XBeeWifiClass::keepConnection(const byte wifiPortDescriptor) {
+  if (!waitCommandResponse()) {
+    sendCloseConnection(wifiPortDescriptor);
+    return false;
   }
-  else if (input.length() == 0) {
-    if (rebootIfNoResponse) {
-      c_restartWifiOnNextUpdate = true;
+  if (wifiPortDescriptor >= WIFI_MAX_PORT_DESCRIPTORS || !bitRead(c_connectedPortsMask, wifiPortDescriptor)) {
+    return true; // closed by client already
+  }
+  // Served port is not counted, it is kept anyway
+  byte keptCount = 0;
+  byte longestIdlePort = WIFI_MAX_PORT_DESCRIPTORS;
+  unsigned long currentMillis = millis();
+  for (byte port = 0; port < WIFI_MAX_PORT_DESCRIPTORS; port++) {
+    if (port == wifiPortDescriptor || !bitRead(c_keptPortsMask, port)) {
+      continue;
     }
-
-    if (g_useSerialMonitor) {
-      showWifiMessage(F("No response"), false);
-      if (rebootIfNoResponse) {
-        Serial.print(F(". Wi-fi will reboot"));
-      }
-      else {
-        Serial.print(F(". Wi-fi skipped it"));
-      }
-      Serial.println();
+    keptCount++;
+    if (longestIdlePort == WIFI_MAX_PORT_DESCRIPTORS || (currentMillis - c_keptPortsMillis[port]) > (currentMillis - c_keptPortsMillis[longestIdlePort])) {
+      longestIdlePort = port;
     }
-
-    // Nothing to do
   }
-  else if (StringUtils::flashStringStartsWith(input, FS(S_WIFI_RESPONSE_ERROR)) && StringUtils::flashStringEndsWith(input, FS(S_CRLF))) {
-    if (g_useSerialMonitor) {
-      byte errorCode = input[5];
-      showWifiMessage(F("Error "), false);
-      Serial.print(StringUtils::byteToHexString(errorCode, true));
-      Serial.println();
+  if (keptCount >= WIFI_KEEP_ALIVE_MAX_CONNECTIONS) {
+    sendCloseConnection(longestIdlePort);
+    if (!bitRead(c_connectedPortsMask, wifiPortDescriptor)) {
+      return true; // closed by client, while other connection was closed
     }
   }
-  else {
-    if (g_useSerialMonitor) {
-      showWifiMessage(NULL, false);
-      PrintUtils::printWithoutCRLF(input);
-      Serial.print(F(" > "));
-      PrintUtils::printHEX(input);
-      Serial.println();
+  bitSet(c_keptPortsMask, wifiPortDescriptor);
+  c_keptPortsMillis[wifiPortDescriptor] = millis();
+  return true;
+}
+
+void RAK410_XBeeWifiClass::closeIdleConnections() {
+  if (c_keptPortsMask == 0) {
+    return;
+  }
+  for (byte port = 0; port < WIFI_MAX_PORT_DESCRIPTORS; port++) {
+    if (bitRead(c_keptPortsMask, port) && (millis() - c_keptPortsMillis[port]) > WIFI_KEEP_ALIVE_TIMEOUT) {
+      if (g_useSerialMonitor) {
+        showWifiMessage(F("Close idle connection "), false);
+        Serial.println(port);
+      }
+      sendCloseConnection(port);
     }
   }
-
-  return false;
 }
 
-String RAK410_XBeeWifiClass::wifiExecuteRawCommand(const __FlashStringHelper* command, size_t maxResponseDeleay) {
+//private:
+
+// Response is read by receive parser, so requests received meanwhile are queued, not taken for response
+boolean RAK410_XBeeWifiClass::wifiExecuteCommand(const __FlashStringHelper* command, size_t maxResponseDeleay, boolean rebootIfNoResponse) {
 
-  Serial_skipAll();
+  waitCommandResponse(); // do not skip it
+  receiveAvailableBytes(); // queue received requests
 
   if (command == NULL) {
     Serial1.println();
@@ -599,27 +1063,65 @@ String RAK410_XBeeWifiClass::wifiExecuteRawCommand(const __FlashStringHelper* co
   }
   c_isWifiPrintCommandStarted = false;
 
-  GB_Controller.updateBreeze();
+  c_isCommandResponsePending = true;
+  c_commandMillis = millis();
+  while (!readCommandResponse()) {
+    GB_Controller.updateBreeze();
+    if (millis() - c_commandMillis > maxResponseDeleay) {
+      c_isCommandResponsePending = false;
+      c_isCommandResponseOK = true;
+      if (rebootIfNoResponse) {
+        c_restartWifiOnNextUpdate = true;
+      }
+      if (g_useSerialMonitor) {
+        showWifiMessage(F("No response"), false);
+        if (rebootIfNoResponse) {
+          Serial.print(F(". Wi-fi will reboot"));
+        }
+        else {
+          Serial.print(F(". Wi-fi skipped it"));
+        }
+        Serial.println();
+      }
+      return false;
+    }
+  }
+  return waitCommandResponse(); // takes result
+}
 
-  String input;
-  input.reserve(10);
-  unsigned long start = millis();
-  while(millis() - start <= maxResponseDeleay) {
-    if (Serial1.available()) {
-      //input += (char) Serial.read(); 
-      //input += Serial.readString(); // WARNING! Problems with command at+ipdhcp=0, it returns bytes with minus sign, Error in Serial library
-      Serial_readString(input);
+// Frame data is completed by CRLF, response is read later
+void RAK410_XBeeWifiClass::sendCommandEnd() {
+  Serial1.println();
+  if (g_useSerialMonitor && c_isWifiPrintCommandStarted) {
+    Serial.println();
+  }
+  c_isWifiPrintCommandStarted = false;
 
-      //showWifiMessage(FS(S_empty), false);
-      //Serial.println(input);
+  c_isCommandResponsePending = true;
+  c_commandMillis = millis();
+}
 
-      GB_Controller.updateBreeze();
-    }
+// Reads available bytes of response without wait. Returns true, if response is completed
+boolean RAK410_XBeeWifiClass::readCommandResponse() {
+  if (c_isCommandResponsePending) {
+    receiveAvailableBytes();
   }
+  return !c_isCommandResponsePending;
+}
 
-  GB_Controller.updateBreeze();
-
-  return input;
+// Returns result of last sent frame or command. Result is taken once, it does not fail next response
+boolean RAK410_XBeeWifiClass::waitCommandResponse() {
+  while (!readCommandResponse()) {
+    GB_Controller.updateBreeze();
+    if (millis() - c_commandMillis > WIFI_RESPONSE_DEFAULT_DELAY) {
+      c_isCommandResponsePending = false;
+      c_isCommandResponseOK = false;
+      showWifiMessage(F("No response on command"));
+    }
+  }
+  boolean isOK = c_isCommandResponseOK;
+  c_isCommandResponseOK = true;
+  return isOK;
 }
 
 RAK410_XBeeWifiClass RAK410_XBeeWifi;
@@ -13,22 +13,124 @@ private:
   static const boolean WIFI_SHOW_AUTO_SIZE_FRAME_DATA = false;
 
   static const word WIFI_MAX_SEND_FRAME_SIZE = 1400; // 1400 max from spec
+  static const byte WIFI_CHUNK_SIZE_DIGITS = 3;       // hex, enough for frame size
+  static const byte WIFI_CHUNK_OVERHEAD = WIFI_CHUNK_SIZE_DIGITS + 4 + 5; // size, CRLF, data, CRLF, last chunk "0\r\n\r\n"
+  static const word WIFI_NO_CHUNK = 0xFFFF;
   static const word WIFI_RESPONSE_DEFAULT_DELAY = 1000; // default delay after "at+" commands 1000ms
+  static const byte WIFI_MAX_PORT_DESCRIPTORS = 8;
+  static const byte WIFI_REQUEST_QUEUE_SIZE = 3;
+  static const byte WIFI_REQUEST_BUFFER_SIZE = 80;      // "path\0query\0[If-None-Match\0]\0", longer request is answered with error
+  static const word WIFI_REQUEST_POST_DATA_SIZE = 336;  // Wi-Fi form with URL-encoded 32 bytes SSID and 64 bytes password
+  static const byte WIFI_REQUEST_IF_NONE_MATCH_SIZE = 24; // longer tag is dropped
+  static const byte WIFI_REQUEST_NO_OFFSET = 0xFF;
+  static const byte WIFI_KEEP_ALIVE_MAX_CONNECTIONS = 4;  // longest idle one is closed, when more are kept
+  static const word WIFI_KEEP_ALIVE_TIMEOUT = 10000;      // ms, idle kept connection is closed after it
 
   boolean c_isWifiPresent;
   boolean c_restartWifiOnNextUpdate;
   boolean c_isWifiPrintCommandStarted;
   unsigned int c_autoSizeFrameSize;
+  word c_autoSizeFrameChunkStart;  // offset of chunk data in frame, WIFI_NO_CHUNK if data is not chunked
+  boolean c_isAutoSizeFrameFailed; // rest of response is dropped, till next response start
   time_t c_lastWifiActivityTimeStamp;
   time_t c_isLastWifiStationMode;
+
+  // Response on sent frame or command is read by receive parser, while next frame is filled
+  boolean c_isCommandResponsePending;
+  boolean c_isCommandResponseOK;
+  boolean c_isWelcomeResponseExpected; // at+reset is answered by welcome message instead of OK
+  unsigned long c_commandMillis;
+
+  // Requests received during response to other client are queued, clients are served by turns.
+  // Request is tokenized into fixed buffer of free slot, served slot is kept till next request.
+  // Post data goes to one shared buffer, forms are posted rarely and by one user
+  enum WifiRequestState{
+    WIFI_REQUEST_STATE_FREE,
+    WIFI_REQUEST_STATE_RECEIVING,
+    WIFI_REQUEST_STATE_QUEUED,
+    WIFI_REQUEST_STATE_SERVING
+  };
+  struct WifiRequest{
+    byte state;
+    byte portDescriptor;
+    byte requestType;
+    byte number;                   // receive order, requests of same port are served FIFO
+    byte queryOffset;
+    byte postDataOffset;
+    byte ifNoneMatchOffset;        // WIFI_REQUEST_NO_OFFSET if header is absent
+    boolean isGzipAccepted;
+    boolean isKeepAlive;           // HTTP/1.1 without "Connection: close"
+    byte length;                   // used bytes of buffer
+    char buffer[WIFI_REQUEST_BUFFER_SIZE];
+  };
+  byte c_connectedPortsMask;       // bit per port descriptor
+  byte c_lastServedPortDescriptor;
+
+  // Connection is kept after length-delimited response, till next request of client or idle timeout
+  byte c_keptPortsMask;            // bit per port descriptor
+  unsigned long c_keptPortsMillis[WIFI_MAX_PORT_DESCRIPTORS]; // start of idle time
+  byte c_nextRequestNumber;
+  WifiRequest c_requests[WIFI_REQUEST_QUEUE_SIZE];
+  byte c_postDataRequestIndex;     // slot owning post data buffer, WIFI_RECEIVE_NO_REQUEST if it is free
+  word c_postDataLength;
+  char c_postData[WIFI_REQUEST_POST_DATA_SIZE];
+
+  // Received frame is parsed by parts, as bytes are available
+  enum ReceiveState{
+    RECEIVE_STATE_COMMAND,           // "at+recv_data=" is expected
+    RECEIVE_STATE_UNKNOWN,           // message of Wi-Fi module, read till line end
+    RECEIVE_STATE_HEADER,
+    RECEIVE_STATE_HTTP_METHOD,
+    RECEIVE_STATE_HTTP_PATH,
+    RECEIVE_STATE_HTTP_QUERY,
+    RECEIVE_STATE_HTTP_REQUEST_LINE, // protocol version is skipped till line end
+    RECEIVE_STATE_HTTP_HEADERS,      // read till empty line, see ReceiveHttpHeader
+    RECEIVE_STATE_HTTP_POST_DATA,
+    RECEIVE_STATE_SKIP               // rest of frame, request is completed after it
+  };
+  static const byte WIFI_RECEIVE_DATA_HEADER_SIZE = 9;
+  static const byte WIFI_RECEIVE_CONNECTION_HEADER_SIZE = 10;
+  static const byte WIFI_RECEIVE_UNKNOWN_LINE_SIZE = 32;
+  static const byte WIFI_RECEIVE_NO_REQUEST = 0xFF;
+
+  // Header line is matched by name, other headers are skipped
+  enum ReceiveHttpHeader{
+    RECEIVE_HTTP_HEADER_NAME,        // first char selects header
+    RECEIVE_HTTP_HEADER_SKIP,
+    RECEIVE_HTTP_HEADER_IF_NONE_MATCH,
+    RECEIVE_HTTP_HEADER_IF_NONE_MATCH_VALUE,   // stored to request buffer
+    RECEIVE_HTTP_HEADER_ACCEPT_ENCODING,
+    RECEIVE_HTTP_HEADER_ACCEPT_ENCODING_VALUE, // searched for "gzip"
+    RECEIVE_HTTP_HEADER_CONNECTION,
+    RECEIVE_HTTP_HEADER_CONNECTION_VALUE       // searched for "close"
+  };
+
+  byte c_receiveState;
+  byte c_receiveIndex;
+  byte c_receiveHttpHeader;
+  byte c_receiveHeaderIndex;       // matched chars of header name or searched value
+  byte c_receiveRequestIndex;      // slot of received request
+  byte c_receivePortDescriptor;
+  byte c_receiveHeader[WIFI_RECEIVE_CONNECTION_HEADER_SIZE];
+  word c_receiveDataLength;        // not received bytes of data or bytes to skip
+  unsigned long c_receiveMillis;   // time of last received byte
+  char c_receiveLine[WIFI_RECEIVE_UNKNOWN_LINE_SIZE];
 #ifndef WIFI_USE_FIXED_SIZE_SUB_FAMES_IN_AUTO_SIZE_FRAME
   char c_autoSizeFrameBuffer[WIFI_MAX_SEND_FRAME_SIZE];
 #endif
 
 public:
 
+#ifdef WIFI_USE_FIXED_SIZE_SUB_FAMES_IN_AUTO_SIZE_FRAME
+  static const boolean WIFI_IS_CHUNKED_TRANSFER_SUPPORTED = false; // frame size is sent before its data
+#else
+  static const boolean WIFI_IS_CHUNKED_TRANSFER_SUPPORTED = true;
+#endif
+
+  // Wrong requests are returned with error type and empty url, they should be answered and closed
   enum RequestType{
-    RAK410_XBEEWIFI_REQUEST_TYPE_NONE, RAK410_XBEEWIFI_REQUEST_TYPE_CLIENT_CONNECTED, RAK410_XBEEWIFI_REQUEST_TYPE_CLIENT_DISCONNECTED, RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_GET, RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_POST
+    RAK410_XBEEWIFI_REQUEST_TYPE_NONE, RAK410_XBEEWIFI_REQUEST_TYPE_CLIENT_CONNECTED, RAK410_XBEEWIFI_REQUEST_TYPE_CLIENT_DISCONNECTED, RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_GET, RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_POST,
+    RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_BAD_REQUEST, RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_TOO_LARGE, RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_BUSY
   };
 
   RAK410_XBeeWifiClass();
@@ -47,30 +149,56 @@ private:
   /////////////////////////////////////////////////////////////////////
 public:
 
-  RequestType handleSerialEvent(byte &wifiPortDescriptor, String &input, String &getParams, String &postParams);
+  RequestType handleSerialEvent(byte &wifiPortDescriptor, char* &url, char* &getParams, char* &postParams, char* &ifNoneMatch, boolean &isGzipAccepted, boolean &isKeepAlive);
+  boolean isRequestQueued();
 
   void sendFixedSizeData(const byte portDescriptor, const __FlashStringHelper* data);
 
   void sendFixedSizeFrameStart(const byte portDescriptor, word length);
   void sendFixedSizeFrameData(const __FlashStringHelper* data);
   void sendFixedSizeFrameData(const String &data);
+  void sendFixedSizeFrameData(const char* data);
   boolean sendFixedSizeFrameStop();
 
   void sendAutoSizeFrameStart(const byte &wifiPortDescriptor);
   boolean sendAutoSizeFrameData(const byte &wifiPortDescriptor, const __FlashStringHelper* data);
-  boolean sendAutoSizeFrameData(const byte &wifiPortDescriptor, const String &data);
-  boolean sendAutoSizeFrameStop(const byte &wifiPortDescriptor);
+  void sendAutoSizeFrameChunksStart();
+  boolean sendAutoSizeFrameStop(const byte &wifiPortDescriptor, boolean isLastFrame = false);
+
+  boolean sendAutoSizeFrameData(const byte &wifiPortDescriptor, const char* data, word length, boolean isProgMem);
 
   boolean sendCloseConnection(const byte portDescriptor);
+  boolean keepConnection(const byte portDescriptor);
+  void closeIdleConnections();
 
 private:
 
+  void receiveAvailableBytes();
+  void resetReceiveState();
+  void handleSerialByte(char c);
+  void startReceiveRequest();
+  boolean appendReceivedChar(char c);
+  boolean appendPostDataChar(char c);
+  void freeRequest(byte index);
+  void completeHttpRequestLine();
+  boolean receiveHttpHeaderChar(char c);
+  void completeHttpHeaders();
+  void queueRequest();
+  void removeQueuedRequests(byte portDescriptor);
+  void removeKeptConnection(byte portDescriptor);
+  void startReceiveSkip(word length);
+  void handleUnknownLine();
+  void handleUnknownHttpRequest(const __FlashStringHelper* description, RequestType errorType = RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_BAD_REQUEST);
+
+  void sendCommandEnd();
+  boolean readCommandResponse();
+  boolean waitCommandResponse();
+
   /////////////////////////////////////////////////////////////////////
   //                               TCP                               //
   /////////////////////////////////////////////////////////////////////
 
   boolean wifiExecuteCommand(const __FlashStringHelper* command = 0, size_t maxResponseDeleay = WIFI_RESPONSE_DEFAULT_DELAY, boolean rebootIfNoResponse=true);
-  String wifiExecuteRawCommand(const __FlashStringHelper* command = 0, size_t maxResponseDeleay = WIFI_RESPONSE_DEFAULT_DELAY);
 
   template <class T> unsigned int wifiExecuteCommandPrint(T command, boolean l_useSerialMonitor = true) {
     unsigned int rez = Serial1.print(command);
@@ -0,0 +1,252 @@
+// Generated by Static/generate_static_files.py, do not edit
+#ifndef StaticFiles_h
+#define StaticFiles_h
+
+#include <Arduino.h>
+
+// growbox.css, 340 bytes, gzip 210 bytes
+const char S_STATIC_STYLE[] PROGMEM =
+  "body{font-family:Arial;max-width:600px;}form{margin:0px;}dt{font-weight:bold;margin-top:5px;}.red{co"
+  "lor:red;}.grab{border-spacing:5px;width:100%;}.align_left{float:left;text-align:left;}.align_center{"
+  "float:center;text-align:center;}.align_right{float:right;text-align:right;}.description{font-size:sm"
+  "all;margin-left:20px;margin-bottom:5px;}";
+const byte S_STATIC_STYLE_GZIP[] PROGMEM = {
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x4D, 0x90, 0xC1, 0x8A, 0xC3, 0x30,
+  0x0C, 0x44, 0xBF, 0x66, 0x8F, 0x2E, 0xE9, 0xC2, 0xEE, 0x41, 0x39, 0xF5, 0x4B, 0x16, 0x39, 0x56,
+  0x5C, 0x81, 0x6D, 0x05, 0x45, 0xD0, 0xB4, 0xA1, 0xFF, 0xBE, 0x71, 0x9C, 0x40, 0x6F, 0x33, 0xA3,
+  0x67, 0xA4, 0xB1, 0x97, 0xF0, 0x5C, 0x47, 0x29, 0xE6, 0x46, 0xCC, 0x9C, 0x9E, 0x70, 0x53, 0xC6,
+  0xD4, 0x67, 0x5C, 0xDC, 0x83, 0x83, 0xDD, 0xE1, 0xB7, 0xEB, 0xA6, 0xA5, 0x7F, 0x8F, 0xA2, 0x79,
+  0xCD, 0xA8, 0x91, 0x0B, 0xEC, 0x41, 0xB0, 0xF6, 0xEC, 0x41, 0x1C, 0xEF, 0x06, 0x5E, 0x52, 0xE8,
+  0xDB, 0xDC, 0x99, 0x4C, 0xF0, 0x53, 0x99, 0x8B, 0x52, 0x58, 0x07, 0x49, 0xA2, 0xB0, 0xA9, 0xCD,
+  0x47, 0x45, 0xBF, 0x7A, 0xD1, 0x40, 0xEA, 0xE6, 0x09, 0x07, 0x2E, 0x71, 0x27, 0xDB, 0xAA, 0x6B,
+  0xD7, 0x7D, 0x6D, 0x10, 0x26, 0x8E, 0xE5, 0x2F, 0xD1, 0xB8, 0x6D, 0x48, 0x82, 0x06, 0x55, 0xF6,
+  0x46, 0x8B, 0xB9, 0x7D, 0xD4, 0xFC, 0xC9, 0x0D, 0x54, 0x8C, 0xF4, 0x20, 0x9B, 0xF9, 0x64, 0x8F,
+  0xE4, 0xA4, 0xB5, 0x1E, 0x7B, 0xC0, 0xBB, 0xFE, 0x64, 0x5B, 0xF0, 0xBE, 0x04, 0x9A, 0x07, 0xE5,
+  0xC9, 0x58, 0x4A, 0xEB, 0x38, 0xF3, 0x8B, 0x60, 0xCE, 0x98, 0xD2, 0x59, 0xB1, 0x9E, 0x00, 0xDF,
+  0xF5, 0x23, 0x8E, 0xC0, 0x8B, 0x99, 0xE4, 0x56, 0xFB, 0x1F, 0x62, 0xB6, 0x31, 0x83, 0x54, 0x01,
+  0x00, 0x00
+};
+
+// growbox.js, 6860 bytes, gzip 2355 bytes
+const char S_STATIC_SCRIPT[] PROGMEM =
+  "var g_timeFormat={year:'numeric',month:'2-digit',day:'2-digit',hour:'2-digit',minute:'2-digit',secon"
+  "d:'2-digit'};function g_onChangeConfigPageSelect(){var select=document.getElementById('configPageSel"
+  "ect');var newValue=select.value;for(var i=0;i<select.options.length;i++){select.options[i].selected="
+  "select.options[i].defaultSelected;}location=newValue;}function g_startClock(timeStamp,growboxTimeSta"
+  "mpId,browserTimeStampId,diffTimeStampId,isAutoCalculated){var gbts=new Date((timeStamp+new Date().ge"
+  "tTimezoneOffset()*60)*1000);var tsDiff=new Date().getTime()-gbts;if(diffTimeStampId){var diffStr='';"
+  "var absTSDiffSec=Math.abs(Math.floor(tsDiff/1000));if(absTSDiffSec>0){var diffSeconds=absTSDiffSec%6"
+  "0;var diffMinutes=Math.floor(absTSDiffSec/60)%60;var diffHours=Math.floor(absTSDiffSec/60/60);if(dif"
+  "fHours>365*24){diffStr='over year';}else if(diffHours>30*24){diffStr='over month';}else if(diffHours"
+  ">7*24){diffStr='over week';}else if(diffHours>24){diffStr='over day';}else if(diffHours>0){diffStr=d"
+  "iffHours+' h '+diffMinutes+' m '+diffSeconds+' s';}else if(diffMinutes>0){diffStr=diffMinutes+' min "
+  "'+diffSeconds+' sec';}else{diffStr=diffSeconds+' sec';}diffStr='Out of sync '+diffStr+' with browser"
+  " time';}else{diffStr='Synced with browser time';}var diffTimeStamp=document.getElementById(diffTimeS"
+  "tampId);if(isAutoCalculated){diffStr='Auto calculated. '+diffStr;diffTimeStamp.style.color='red';}el"
+  "se if(absTSDiffSec>60){diffTimeStamp.style.color='red';}diffTimeStamp.innerHTML=diffStr;}function up"
+  "dateTimeStamps(){var bts=new Date();gbts.setTime(bts.getTime()-tsDiff);if(growboxTimeStampId){docume"
+  "nt.getElementById(growboxTimeStampId).innerHTML=gbts.toLocaleString('uk',g_timeFormat);}if(browserTi"
+  "meStampId){document.getElementById(browserTimeStampId).innerHTML=bts.toLocaleString('uk',g_timeForma"
+  "t);}setTimeout(updateTimeStamps,1000);}updateTimeStamps();}function g_checkBeforeSetClockTime(hidden"
+  "InputId){if(!confirm('Syncronize Growbox time with browser time?')){return false;}document.getElemen"
+  "tById(hiddenInputId).value=Math.floor(new Date().getTime()/1000-new Date().getTimezoneOffset()*60);r"
+  "eturn true;}function g_wordTimeToString(time){var hour=Math.floor(time/60);var minute=time%60;return"
+  " (hour<10?'0':'')+hour+':'+(minute<10?'0':'')+minute;}function g_updDayNightPeriod(){var upTime=new "
+  "Date('01.01.2000 '+document.getElementById('turnToDayModeAt').value+':00');var downTime=new Date('01"
+  ".01.2000 '+document.getElementById('turnToNightModeAt').value+':00');var delta=Math.floor((downTime-"
+  "upTime)/1000/60);var dayPeriod=(delta>0?delta:24*60+delta);document.getElementById('dayNightPeriod')"
+  ".innerHTML=g_wordTimeToString(dayPeriod)+'/'+g_wordTimeToString(24*60-dayPeriod);}var g_logRecords=["
+  "];var g_logDate='';function g_twoDigits(number){return (number<10?'0':'')+number;}function g_logDay("
+  "timeStamp){var date=new Date(timeStamp*1000);return g_twoDigits(date.getUTCDate())+'.'+g_twoDigits(d"
+  "ate.getUTCMonth()+1)+'.'+date.getUTCFullYear();}function g_logTime(timeStamp){var date=new Date(time"
+  "Stamp*1000);return g_twoDigits(date.getUTCHours())+':'+g_twoDigits(date.getUTCMinutes())+':'+g_twoDi"
+  "gits(date.getUTCSeconds());}function g_isLogRecordEmpty(record){return (record.timeStamp==0&&record."
+  "data==0&&record.data1==0);}function g_isLogRecordPassTypeFilter(record,type){var types={events:0,err"
+  "ors:1,wateringevents:2,temperature:3};if(!(type in types)){return true;}return !g_isLogRecordEmpty(r"
+  "ecord)&&(record.data>>6)==types[type];}function g_logRecordDescription(record){var descriptions=g_lo"
+  "gDescriptions;var code=record.data&63;var type=record.data>>6;if(g_isLogRecordEmpty(record)){return "
+  "'Log record not loaded';}if(type==0){var text=descriptions.e[code]||'Unknown Event';if(descriptions."
+  "fan.indexOf(code)>=0&&record.data1!=0){text+=', '+(record.data1>>4)*descriptions.step+'/'+(record.da"
+  "ta1&15)*descriptions.step+' min';}return text;}if(type==1){return descriptions.r[code]||'Unknown Err"
+  "or';}if(type==3){return 'Temperature '+code+'&deg;C';}var wateringEvent=descriptions.w[code&15];var "
+  "text=(wateringEvent?wateringEvent[0]:'Unknown Watering event')+' system #'+((code>>4)+1);if(watering"
+  "Event&&wateringEvent[1]==1){text+=', value '+record.data1;}else if(wateringEvent&&wateringEvent[1]=="
+  "2){text+=' during '+record.data1+' sec';}return text;}function g_showLog(url,date){g_logDate=date;va"
+  "r request=new XMLHttpRequest();request.open('GET',url);request.responseType='arraybuffer';request.on"
+  "load=function(){var view=new DataView(request.response);for(var i=0;i+6<=view.byteLength;i+=6){g_log"
+  "Records.push({timeStamp:view.getUint32(i,true),data:view.getUint8(i+4),data1:view.getUint8(i+5)});}g"
+  "_updateLog();};request.onerror=function(){document.getElementById('logTable').innerHTML='Log loading"
+  " failed';};request.send();}function g_updateLog(){var type=document.getElementById('typeCombobox').v"
+  "alue;var dateCombobox=document.getElementById('dateCombobox');if(dateCombobox.value){g_logDate=dateC"
+  "ombobox.value;}var isAllTypes=(type=='all');var isAllDays=(g_logDate=='all');var days=[];var dayCoun"
+  "ts={};var allCounts=[0,0];var rows='';var lastDay='';for(var i=0;i<g_logRecords.length;i++){var reco"
+  "rd=g_logRecords[i];var day=g_logDay(record.timeStamp);if(!(day in dayCounts)){dayCounts[day]=[0,0];d"
+  "ays.push(day);}dayCounts[day][1]++;allCounts[1]++;if(!g_isLogRecordPassTypeFilter(record,type)){cont"
+  "inue;}dayCounts[day][0]++;allCounts[0]++;if(!isAllDays&&day!=g_logDate){continue;}var style='';if((r"
+  "ecord.data>>6)==1||g_isLogRecordEmpty(record)){style='color:red;';}else if((record.data>>6)==0&&g_lo"
+  "gDescriptions.bold.indexOf(record.data)>=0){style='font-weight:bold;';}rows+='<tr><td>'+(isAllDays?a"
+  "llCounts[0]:dayCounts[day][0])+'</td>';if(isAllDays){rows+=\"<td style='font-weight:bold;'>\"+(day!="
+  "lastDay?day:'')+'</td>';}rows+='<td>'+g_logTime(record.timeStamp)+\"</td><td style='text-align:left;"
+  "\"+style+\"'>\"+g_logRecordDescription(record)+'</td></tr>';lastDay=day;}if(!isAllDays&&!(g_logDate "
+  "in dayCounts)){dayCounts[g_logDate]=[0,0];days.push(g_logDate);}var options='';function countsText(c"
+  "ounts){return '  ('+(isAllTypes?'':counts[0]+'/')+counts[1]+')';}function option(value,text,isSelect"
+  "ed){return \"<option value='\"+value+\"'\"+(isSelected?\" selected='selected' style='font-weight:bol"
+  "d;'\":'')+'>'+text+'</option>';}for(var i=0;i<days.length;i++){options+=option(days[i],days[i]+count"
+  "sText(dayCounts[days[i]]),days[i]==g_logDate);}options+=option('all','All days'+countsText(allCounts"
+  "),isAllDays);dateCombobox.innerHTML=options;var table=document.getElementById('logTable');if(rows){t"
+  "able.innerHTML=\"<table class='grab align_center'><tr><th>#</th>\"+(isAllDays?'<th>Day</th>':'')+'<t"
+  "h>Time</th><th>Description</th></tr>'+rows+'</table>';}else{var typeNames={events:'Event',wateringev"
+  "ents:'Watering event',errors:'Error',temperature:'Temperature'};table.innerHTML='<br/>'+(typeNames[t"
+  "ype]||'Log')+' records not found for '+(isAllDays?'all days':g_logDate);}}";
+const byte S_STATIC_SCRIPT_GZIP[] PROGMEM = {
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xAD, 0x18, 0x0D, 0x6F, 0xDB, 0xB8,
+  0xF5, 0xAF, 0x28, 0x3E, 0xCC, 0x94, 0x2A, 0xC5, 0x95, 0x93, 0x36, 0x1B, 0xAC, 0xC8, 0xC1, 0x5D,
+  0xD2, 0x5E, 0x0B, 0x24, 0xD7, 0xE2, 0xE2, 0xBB, 0x6D, 0x08, 0x82, 0x42, 0x96, 0x68, 0x5B, 0x88,
+  0x2C, 0x79, 0x14, 0x15, 0xD7, 0xE7, 0xFA, 0xBF, 0xEF, 0x3D, 0x92, 0xA2, 0x28, 0xD9, 0x4E, 0x0B,
+  0x6C, 0x40, 0xE0, 0x90, 0xEF, 0x9B, 0x8F, 0xEF, 0x8B, 0x7A, 0x8E, 0x98, 0x35, 0xFF, 0xC2, 0xD3,
+  0x25, 0x7D, 0x5F, 0xB0, 0x65, 0xC4, 0xC3, 0xED, 0x86, 0x46, 0x6C, 0x44, 0xF2, 0x6A, 0x49, 0x59,
+  0x1A, 0x13, 0x6F, 0x59, 0xE4, 0x7C, 0x31, 0x22, 0x67, 0xA7, 0x49, 0x3A, 0x4F, 0x39, 0xF1, 0x92,
+  0x68, 0x63, 0xEC, 0x16, 0x45, 0xC5, 0x8C, 0xED, 0x32, 0xCD, 0x2B, 0x4E, 0x0D, 0x40, 0x49, 0xE3,
+  0x22, 0x4F, 0x1A, 0xC0, 0x2E, 0x98, 0x55, 0x79, 0xCC, 0xD3, 0x22, 0x07, 0xAD, 0x45, 0x7E, 0xBD,
+  0x88, 0xF2, 0x39, 0xBD, 0x2E, 0xF2, 0x59, 0x3A, 0xFF, 0x1C, 0xCD, 0xE9, 0x3D, 0xCD, 0x68, 0xCC,
+  0x6D, 0x67, 0xFB, 0x0C, 0x66, 0x95, 0x62, 0x13, 0x26, 0x45, 0x0C, 0xB6, 0xE4, 0x7C, 0x30, 0xA7,
+  0xFC, 0x5D, 0x46, 0x71, 0xF9, 0xCB, 0xE6, 0x63, 0x62, 0x93, 0xB8, 0xC3, 0x46, 0x9C, 0x00, 0xD9,
+  0x72, 0xBA, 0xFE, 0x33, 0xCA, 0x2A, 0x1A, 0x4A, 0xFE, 0xC1, 0x33, 0x6E, 0x82, 0x59, 0xC1, 0x6C,
+  0xC4, 0xA6, 0xA1, 0x1F, 0xA4, 0x97, 0x0A, 0x55, 0xAC, 0xD0, 0x92, 0x72, 0x90, 0xD1, 0x7C, 0xCE,
+  0x17, 0x41, 0xEA, 0xBA, 0xCE, 0xB6, 0x8D, 0x7A, 0x48, 0x1F, 0x07, 0x12, 0x42, 0x93, 0x70, 0x1F,
+  0x95, 0xD0, 0x59, 0x54, 0x65, 0xFC, 0x5E, 0x51, 0x04, 0xBB, 0xAC, 0x88, 0x23, 0xC4, 0x86, 0xB5,
+  0x15, 0xC1, 0xCE, 0x38, 0x70, 0xC9, 0x23, 0xC6, 0xAF, 0x81, 0xE6, 0xC9, 0x46, 0x8F, 0xDF, 0xF3,
+  0x68, 0xB9, 0xF2, 0xE6, 0xAC, 0x58, 0x4F, 0x8B, 0xAF, 0x93, 0x1A, 0xF0, 0x31, 0xF1, 0xA6, 0x00,
+  0x2A, 0x29, 0x33, 0x41, 0x49, 0x3A, 0x9B, 0x99, 0xFB, 0xB4, 0xFC, 0xB9, 0xE2, 0xC5, 0x75, 0x94,
+  0xC5, 0x55, 0x16, 0x81, 0x6A, 0xE9, 0xB2, 0xF9, 0x94, 0x97, 0xA8, 0xDA, 0xBA, 0x01, 0x98, 0xDD,
+  0x28, 0x71, 0x35, 0xCC, 0x41, 0x37, 0xA2, 0xA0, 0xBF, 0x8A, 0x9C, 0x7E, 0x9A, 0xCD, 0x4A, 0x0A,
+  0xEE, 0x7E, 0x75, 0xE1, 0x3B, 0xAF, 0x86, 0xBE, 0xEF, 0x4B, 0x0F, 0xF2, 0xF2, 0x06, 0xB4, 0x85,
+  0xFB, 0x3C, 0xB6, 0x73, 0x8A, 0x1A, 0x82, 0x74, 0x66, 0x77, 0xEC, 0x91, 0xEA, 0x11, 0x78, 0xCF,
+  0x59, 0x48, 0x88, 0x90, 0x13, 0x4D, 0xCB, 0xC9, 0x3D, 0x8A, 0xBA, 0xA7, 0x71, 0x78, 0x17, 0xF1,
+  0xC5, 0x00, 0x20, 0xB6, 0x58, 0xCC, 0xB2, 0x02, 0x2E, 0x44, 0x2A, 0x7A, 0x2D, 0x34, 0x3B, 0x28,
+  0xD5, 0xE4, 0x18, 0xFB, 0x86, 0x50, 0x11, 0x46, 0x65, 0x68, 0xE2, 0xFF, 0x76, 0xE1, 0x07, 0x35,
+  0xFE, 0x4E, 0xC4, 0x5D, 0x19, 0x1A, 0xB2, 0x4D, 0xD2, 0xD7, 0x70, 0x3E, 0x93, 0xFC, 0x03, 0x44,
+  0xED, 0x4B, 0xC4, 0x48, 0x5F, 0x1F, 0x52, 0xD0, 0x8E, 0xCF, 0x2F, 0xDE, 0xBE, 0x3A, 0x7B, 0xE3,
+  0x6C, 0xF5, 0x09, 0x8B, 0x67, 0xCA, 0x2C, 0x4C, 0x15, 0x12, 0xEC, 0x68, 0x56, 0x52, 0xAB, 0x4D,
+  0xEE, 0x1F, 0xA0, 0x16, 0x99, 0x74, 0x90, 0xFC, 0xEF, 0x07, 0xA8, 0xD7, 0x94, 0x3E, 0x1D, 0x24,
+  0xDE, 0x27, 0x85, 0x94, 0x3C, 0x48, 0xE9, 0x37, 0x84, 0x1A, 0xE8, 0x12, 0x6B, 0x61, 0x11, 0xD7,
+  0x70, 0x1A, 0x40, 0x96, 0x0A, 0xA2, 0xDC, 0x0C, 0x90, 0xB2, 0x23, 0x50, 0xD1, 0x76, 0x45, 0x1A,
+  0x22, 0xD2, 0x7C, 0x5F, 0x08, 0x8D, 0x95, 0x98, 0x16, 0x53, 0x97, 0x40, 0x1F, 0xE6, 0x53, 0xC5,
+  0xAD, 0x62, 0x66, 0x95, 0x9B, 0x3C, 0xAE, 0x65, 0x71, 0x06, 0x64, 0xEB, 0x94, 0x2F, 0x2C, 0x95,
+  0x13, 0x16, 0xC6, 0x74, 0x57, 0x2A, 0xB9, 0x07, 0x16, 0x9A, 0x1C, 0x24, 0xAC, 0xEF, 0x5C, 0x07,
+  0xEB, 0xD1, 0x82, 0xD2, 0x0D, 0x69, 0x8C, 0x80, 0xFD, 0x34, 0xD3, 0x3A, 0x11, 0x61, 0xC5, 0x1A,
+  0x33, 0x68, 0x4C, 0x0E, 0x5A, 0x92, 0x06, 0x25, 0xDF, 0x64, 0x74, 0x10, 0x17, 0x59, 0x01, 0x5C,
+  0x8C, 0x26, 0x86, 0x6B, 0x5B, 0xF1, 0x7E, 0xA1, 0x9C, 0xFB, 0x22, 0x67, 0x9B, 0x20, 0xCD, 0x73,
+  0xCA, 0x3E, 0x4C, 0xEE, 0x6E, 0xC3, 0x5A, 0x75, 0x53, 0x6E, 0xAA, 0x55, 0x02, 0x76, 0x69, 0xDA,
+  0x52, 0x55, 0xD5, 0x56, 0x85, 0x70, 0x02, 0xCC, 0x67, 0xA8, 0x70, 0x32, 0xBD, 0x71, 0xDD, 0xA4,
+  0xBA, 0xCC, 0x4E, 0xE1, 0x86, 0xFD, 0x1A, 0x05, 0xA6, 0x1E, 0x71, 0xE3, 0x01, 0x5A, 0xC3, 0x4E,
+  0xA1, 0x8F, 0x17, 0xB7, 0x50, 0x27, 0x33, 0xC0, 0xB3, 0x34, 0x9F, 0xDB, 0xA4, 0x7A, 0x22, 0x9E,
+  0xD9, 0x84, 0x9C, 0x60, 0x07, 0x4A, 0xF7, 0xAB, 0xE0, 0x71, 0xA5, 0x07, 0x68, 0x0D, 0xA5, 0x3F,
+  0xA8, 0x53, 0xB9, 0xA1, 0xA8, 0xB8, 0xDD, 0x75, 0x9E, 0x27, 0xAB, 0xE3, 0x6E, 0xDF, 0xA9, 0xAD,
+  0x02, 0x1F, 0x2F, 0x68, 0xFC, 0xF4, 0x0B, 0x85, 0x66, 0x03, 0x3D, 0x49, 0x56, 0x7A, 0xE1, 0xCC,
+  0x45, 0x9A, 0x24, 0x34, 0xFF, 0x98, 0xAF, 0x2A, 0x8E, 0xA7, 0x80, 0xC3, 0x9D, 0x88, 0xEE, 0xC5,
+  0x96, 0xB6, 0x88, 0x5D, 0x56, 0xE4, 0xE9, 0x5F, 0xD4, 0xFA, 0x55, 0xBA, 0x4E, 0x84, 0xEE, 0x7E,
+  0x30, 0x5F, 0x11, 0xC7, 0xD9, 0x32, 0xCA, 0x2B, 0x96, 0x5B, 0xB3, 0x08, 0x22, 0x08, 0xA2, 0xE1,
+  0x88, 0x3B, 0xDA, 0xFA, 0x64, 0x0B, 0x34, 0xEB, 0xDD, 0xA1, 0xD2, 0x2E, 0xCA, 0xF0, 0xE9, 0xF7,
+  0x1B, 0x45, 0xA0, 0x4C, 0xE0, 0xAC, 0xD3, 0xDD, 0xD6, 0x05, 0x4B, 0x90, 0x61, 0x52, 0x28, 0x1F,
+  0xA3, 0xD1, 0x32, 0xE8, 0x70, 0x4C, 0x30, 0xF5, 0x23, 0x46, 0x14, 0x59, 0x44, 0xCA, 0xA1, 0x21,
+  0x44, 0x18, 0x16, 0x69, 0x25, 0xDE, 0x46, 0x9E, 0xCB, 0xA1, 0x7F, 0x45, 0x7C, 0x32, 0x22, 0xC4,
+  0x71, 0x71, 0xEF, 0xC2, 0xD2, 0xB5, 0x25, 0x83, 0x89, 0x93, 0x90, 0x96, 0x35, 0x70, 0x53, 0x37,
+  0xD1, 0xE6, 0xB7, 0x74, 0xBE, 0xE0, 0x9F, 0x61, 0x92, 0x29, 0x12, 0x15, 0xFF, 0xD5, 0x0A, 0x6D,
+  0x6C, 0x52, 0x80, 0xF8, 0xC3, 0x01, 0xFC, 0x9D, 0xC1, 0xE1, 0x31, 0x83, 0x8F, 0x0D, 0x1B, 0x68,
+  0xD3, 0xA4, 0x00, 0x89, 0x77, 0x45, 0x42, 0x7F, 0x86, 0x59, 0x43, 0x3A, 0x15, 0x0C, 0xF2, 0x7D,
+  0x35, 0x78, 0x24, 0xC5, 0x3A, 0xFF, 0x1F, 0x64, 0x0B, 0x53, 0x5F, 0x90, 0x4E, 0x33, 0x1E, 0x99,
+  0x3E, 0xB4, 0x6B, 0x7D, 0xA7, 0xF2, 0x48, 0xF2, 0x02, 0xB5, 0x57, 0xA1, 0x29, 0xC8, 0x73, 0x87,
+  0xB6, 0x60, 0x1D, 0xFB, 0x57, 0xE2, 0xFF, 0xE8, 0xEC, 0x0D, 0xDC, 0xA2, 0x2B, 0xD6, 0x4E, 0x70,
+  0xD4, 0xA6, 0xA4, 0xE5, 0x3B, 0xD2, 0x4A, 0xE1, 0xFD, 0x9B, 0xD6, 0xCA, 0x1C, 0x97, 0xBC, 0x26,
+  0xEE, 0x01, 0x0A, 0xA1, 0xF5, 0xB4, 0xA1, 0x93, 0x85, 0x79, 0xFE, 0x25, 0x2B, 0xE6, 0xBF, 0x43,
+  0x3F, 0x60, 0xD0, 0xDC, 0x1F, 0x1E, 0x03, 0x0D, 0x43, 0xF7, 0xE1, 0x18, 0x61, 0x5C, 0x28, 0x5F,
+  0x17, 0x37, 0x38, 0x43, 0x96, 0x36, 0xCC, 0xA6, 0x53, 0xCA, 0x74, 0x2E, 0xA8, 0xBD, 0x19, 0x0F,
+  0x12, 0xD2, 0x8A, 0x07, 0x21, 0x74, 0xD3, 0x8C, 0x44, 0x6A, 0xB8, 0x40, 0x3D, 0xFA, 0xBE, 0x34,
+  0x52, 0x0D, 0x43, 0x4A, 0x81, 0xA9, 0x1B, 0x19, 0xD0, 0x59, 0x7F, 0x4C, 0xAE, 0x65, 0x9A, 0xC0,
+  0x89, 0x07, 0x78, 0xE2, 0x83, 0x24, 0x77, 0xD8, 0xF2, 0x6D, 0xC7, 0x1D, 0x4A, 0x2A, 0x03, 0xF3,
+  0xBE, 0xCA, 0xB2, 0x7F, 0xC3, 0xF8, 0xD0, 0x29, 0x20, 0x60, 0xA5, 0xC8, 0xC6, 0xFF, 0xA3, 0x99,
+  0xA2, 0xED, 0x0B, 0x3B, 0x47, 0xC7, 0xED, 0x94, 0x7D, 0xFC, 0x3B, 0x54, 0xAA, 0x71, 0x03, 0x55,
+  0xCB, 0xE6, 0xB4, 0xBC, 0xAD, 0x2F, 0xF1, 0xDD, 0x72, 0xC5, 0x37, 0x36, 0x13, 0xEB, 0xE6, 0x7E,
+  0xE4, 0x7E, 0xA0, 0xCD, 0x0E, 0x43, 0xBF, 0xDF, 0x57, 0x40, 0x10, 0x1F, 0x75, 0xF7, 0x43, 0x00,
+  0x1C, 0x55, 0xF1, 0x39, 0x2A, 0xCB, 0xC9, 0x66, 0x45, 0xDF, 0xA7, 0x19, 0xA7, 0x4C, 0xC9, 0xF6,
+  0x38, 0x40, 0xA4, 0xAB, 0x70, 0x55, 0x86, 0x5B, 0xFA, 0x0C, 0xA1, 0x5C, 0x8E, 0x7C, 0x8F, 0x32,
+  0x56, 0xB0, 0x72, 0x34, 0xF4, 0xD6, 0x70, 0x10, 0x0C, 0x45, 0x85, 0x39, 0xF3, 0x38, 0x5D, 0xAE,
+  0x28, 0x8B, 0xC0, 0x46, 0x3A, 0x3A, 0xDF, 0x61, 0x9B, 0x3B, 0xB1, 0x91, 0xDB, 0x82, 0x51, 0x46,
+  0x48, 0x69, 0xCA, 0xAD, 0xAC, 0x75, 0x6A, 0x73, 0x72, 0xFC, 0xC8, 0xFD, 0xBE, 0x6D, 0x9C, 0x63,
+  0x3C, 0xBE, 0x70, 0xC2, 0x50, 0x88, 0x7A, 0xC0, 0xDF, 0xC7, 0xEE, 0x55, 0x4B, 0x09, 0x37, 0xB4,
+  0x8C, 0x59, 0x2A, 0x1E, 0x15, 0xDA, 0x75, 0x32, 0xE3, 0x35, 0xBC, 0x0C, 0x65, 0x00, 0x1B, 0x10,
+  0x91, 0x2B, 0x31, 0x94, 0x8B, 0xD0, 0xD0, 0xD8, 0xBF, 0x38, 0x0F, 0x6A, 0x27, 0x84, 0x6D, 0x4B,
+  0x44, 0x1B, 0x3F, 0x6A, 0xB8, 0x3E, 0x29, 0x01, 0xBC, 0x25, 0x81, 0x56, 0x5E, 0x70, 0x2B, 0x2B,
+  0xA2, 0x44, 0x0C, 0x1E, 0xC0, 0x2E, 0xA4, 0x86, 0x6A, 0x2C, 0xE7, 0xF4, 0x2B, 0xBC, 0xCD, 0x0C,
+  0x83, 0x06, 0xF4, 0x01, 0xCD, 0x79, 0xFC, 0xF6, 0x8D, 0xFC, 0x91, 0x3F, 0xE5, 0x50, 0x9C, 0xAC,
+  0x77, 0xE8, 0x6A, 0x22, 0x26, 0x69, 0x93, 0x70, 0x16, 0xE5, 0x50, 0x4E, 0x12, 0xFA, 0xF5, 0xD3,
+  0xCC, 0x46, 0x16, 0x67, 0xDC, 0x0D, 0x80, 0x13, 0xD4, 0x82, 0x1A, 0xDC, 0x90, 0x78, 0x50, 0x3A,
+  0x4D, 0xAF, 0x0E, 0xC7, 0xE3, 0x37, 0xCE, 0xAB, 0x96, 0xC0, 0x92, 0xD3, 0x95, 0x28, 0x3C, 0x2D,
+  0xBA, 0xFE, 0xF0, 0xED, 0x41, 0x3A, 0x6C, 0x38, 0x44, 0xDF, 0x26, 0x6A, 0x31, 0x4E, 0x37, 0xD4,
+  0x9E, 0x68, 0x71, 0xB2, 0xFD, 0xB3, 0x61, 0x5C, 0x99, 0x7E, 0x39, 0x6F, 0x7C, 0x38, 0x69, 0x22,
+  0x0B, 0x8C, 0x47, 0x4E, 0x97, 0xF4, 0x13, 0x3A, 0x0F, 0xAE, 0xD5, 0x40, 0x5A, 0xC7, 0xA2, 0x70,
+  0x50, 0xDB, 0x8B, 0x6B, 0xA1, 0x09, 0x6C, 0x97, 0xD5, 0x50, 0xB8, 0xD9, 0x6E, 0xD1, 0x5F, 0xB5,
+  0x76, 0x0F, 0xFE, 0xE3, 0x48, 0x1B, 0xF5, 0x4F, 0x85, 0xB1, 0x44, 0x90, 0x43, 0x21, 0x84, 0x19,
+  0x7B, 0x03, 0xA7, 0x5E, 0x5A, 0x3F, 0x81, 0x73, 0x84, 0xB3, 0xD1, 0x7B, 0x50, 0x8F, 0xF0, 0x52,
+  0x5A, 0x72, 0xFA, 0xFD, 0xB6, 0xD8, 0xE1, 0xA3, 0x70, 0x86, 0xBE, 0x04, 0xD1, 0x90, 0xE0, 0x34,
+  0xA6, 0x87, 0x9B, 0x41, 0xF6, 0xBB, 0xA2, 0xCE, 0xB4, 0x28, 0x2B, 0xA9, 0x84, 0x89, 0x6D, 0x51,
+  0xFA, 0x35, 0xD0, 0xBA, 0x16, 0xF3, 0xED, 0xBC, 0x28, 0xD6, 0x10, 0x9B, 0x76, 0xC5, 0x32, 0x0F,
+  0x6B, 0x92, 0xB3, 0x6D, 0x1A, 0x05, 0xEE, 0x85, 0xB7, 0x18, 0xFD, 0x4F, 0x45, 0x4B, 0x2E, 0x4A,
+  0xE5, 0xBF, 0xEE, 0x6E, 0x3F, 0x70, 0xBE, 0xFA, 0x5D, 0x82, 0x6C, 0x2C, 0x93, 0x62, 0x05, 0xEF,
+  0x77, 0x9A, 0xDB, 0xE4, 0xD7, 0x77, 0x13, 0xE2, 0x81, 0xB0, 0x06, 0xCE, 0x68, 0xB9, 0x82, 0x1B,
+  0xA0, 0x58, 0x5D, 0x42, 0x12, 0x31, 0x16, 0x6D, 0xA6, 0xD5, 0x6C, 0x46, 0xE1, 0x96, 0x35, 0x6B,
+  0x8E, 0xF9, 0x10, 0xD6, 0x66, 0xA9, 0x91, 0xE2, 0x39, 0xA5, 0xEB, 0xBA, 0x3A, 0x47, 0x7F, 0xC2,
+  0xC6, 0xEE, 0x8A, 0x74, 0xDA, 0xDF, 0x1F, 0xDC, 0x8B, 0xCB, 0x10, 0x99, 0x06, 0xD3, 0x0D, 0xA7,
+  0xB7, 0xF5, 0xC7, 0x87, 0xF0, 0x42, 0x9D, 0x49, 0x35, 0xC4, 0xC1, 0xAA, 0x2A, 0x17, 0xF6, 0x56,
+  0x97, 0xCD, 0x91, 0x60, 0xC1, 0x52, 0x9C, 0xE6, 0xFC, 0xFC, 0xCC, 0x4E, 0x3D, 0x2C, 0x4B, 0x0E,
+  0x7A, 0x23, 0x6A, 0xE1, 0xFE, 0x61, 0xA7, 0xEE, 0x1B, 0x09, 0x1F, 0xEE, 0x21, 0xDE, 0x3A, 0x3B,
+  0xA8, 0xAD, 0x62, 0x3E, 0x02, 0xAF, 0xA1, 0x47, 0x61, 0x6B, 0x1C, 0x50, 0xD4, 0x4B, 0xF3, 0x84,
+  0x47, 0x47, 0x04, 0xEC, 0x55, 0xD1, 0x34, 0xA3, 0xAD, 0xE1, 0x40, 0xD4, 0x0F, 0x74, 0x12, 0x5E,
+  0xF1, 0x2C, 0x4A, 0x33, 0x51, 0x3C, 0xB4, 0xFC, 0x92, 0xE6, 0x49, 0xA7, 0xE5, 0x19, 0x86, 0xE8,
+  0x02, 0x7E, 0xFC, 0xA3, 0x0F, 0x62, 0xAF, 0x8B, 0xE5, 0xB4, 0x80, 0x39, 0xB9, 0x1E, 0x93, 0x82,
+  0xBA, 0x45, 0xD6, 0x88, 0xF0, 0x85, 0xB1, 0x86, 0x1B, 0xEC, 0xA2, 0x32, 0x19, 0x10, 0x29, 0xAE,
+  0x1B, 0x59, 0x6D, 0xAC, 0x4C, 0x60, 0x78, 0x17, 0x66, 0xD9, 0x44, 0xB4, 0x1A, 0x95, 0xFE, 0x24,
+  0xCA, 0x32, 0x35, 0xAA, 0x09, 0x24, 0x0C, 0x1B, 0x80, 0x6B, 0x24, 0x99, 0x04, 0x09, 0xE2, 0xD4,
+  0xB8, 0x03, 0xEB, 0xEB, 0xA2, 0x82, 0x8E, 0x14, 0x6E, 0x77, 0xF2, 0xAB, 0x49, 0x96, 0x29, 0xC0,
+  0x83, 0xEF, 0xF9, 0x92, 0x08, 0x5F, 0x01, 0xF5, 0x57, 0x95, 0x2C, 0x2A, 0x39, 0x08, 0x17, 0xD3,
+  0x51, 0xEB, 0xA3, 0x56, 0x2B, 0x76, 0xCC, 0x4F, 0x5A, 0x32, 0x33, 0x10, 0x1E, 0x9A, 0x34, 0x0F,
+  0xA9, 0xB6, 0x20, 0xD4, 0xF3, 0x51, 0xB7, 0x57, 0x3B, 0xB2, 0x2F, 0x02, 0x0D, 0xB6, 0x45, 0x6D,
+  0x2C, 0x34, 0x0C, 0xBD, 0x7E, 0x80, 0xD5, 0xA3, 0x32, 0x16, 0x4F, 0x26, 0xE3, 0x16, 0x56, 0x70,
+  0xCF, 0x6D, 0x22, 0xA8, 0x04, 0xAE, 0x1B, 0xE8, 0x03, 0xCA, 0x2D, 0xCA, 0xFF, 0xD1, 0x0E, 0xEF,
+  0x6C, 0x61, 0x02, 0xE1, 0x30, 0xAC, 0xD0, 0x3D, 0xD1, 0x7E, 0x5B, 0xB4, 0x5F, 0x8B, 0xD6, 0x97,
+  0xD1, 0xEF, 0x03, 0xDD, 0x49, 0xA8, 0x6F, 0xC4, 0x94, 0x25, 0x3E, 0x37, 0xE2, 0x63, 0x1B, 0xBD,
+  0x0A, 0x5C, 0xFB, 0x5D, 0x7C, 0xF8, 0xED, 0xDB, 0x4B, 0xDD, 0x53, 0x31, 0x8B, 0xA7, 0xFA, 0x08,
+  0x5E, 0xEA, 0x81, 0xF1, 0xC8, 0xDF, 0x17, 0x06, 0xDD, 0x6E, 0xAF, 0x9F, 0x0F, 0xA6, 0x45, 0x96,
+  0xE8, 0xB6, 0x68, 0xB0, 0x60, 0x77, 0xD4, 0x0A, 0x66, 0x60, 0xF2, 0xE9, 0x9A, 0xE2, 0x64, 0x3E,
+  0x42, 0x06, 0xD4, 0x83, 0xC1, 0x01, 0x75, 0xF5, 0x92, 0xB3, 0xF1, 0x25, 0x4F, 0xC6, 0x50, 0xE8,
+  0xF5, 0x99, 0xAF, 0x4C, 0x87, 0x8C, 0xF6, 0x3C, 0x06, 0xFD, 0xE1, 0xF2, 0x35, 0xB2, 0xA8, 0x4F,
+  0x1D, 0x92, 0x09, 0xFA, 0x98, 0x90, 0xD8, 0x03, 0x69, 0xD6, 0x51, 0xBD, 0xE3, 0x9E, 0x6B, 0x0B,
+  0x87, 0xAA, 0x78, 0xBC, 0x12, 0x1F, 0x86, 0x49, 0x23, 0xB2, 0xB1, 0x0B, 0x6D, 0x6A, 0x46, 0xDB,
+  0xBD, 0x08, 0x73, 0x7B, 0x82, 0xC3, 0xD0, 0x86, 0xC5, 0xFF, 0x34, 0xCA, 0xD2, 0x79, 0x3E, 0xCA,
+  0xE8, 0x8C, 0x07, 0x3D, 0x57, 0x20, 0xDC, 0x1E, 0x6A, 0x7D, 0x79, 0x72, 0x52, 0xEA, 0xE1, 0x87,
+  0x81, 0x0D, 0x75, 0xAE, 0x80, 0x6D, 0xA2, 0x53, 0x9B, 0xD1, 0x70, 0xD2, 0x24, 0xE7, 0xF1, 0xD0,
+  0xD6, 0x24, 0xFB, 0x01, 0xDE, 0x04, 0x92, 0x8C, 0x1F, 0xF5, 0x59, 0xB8, 0xF5, 0x6A, 0x89, 0x85,
+  0x94, 0x09, 0x1C, 0xC7, 0x96, 0xCB, 0x66, 0x46, 0xB0, 0x2C, 0xBB, 0xBE, 0x29, 0x51, 0x47, 0xAE,
+  0x08, 0x19, 0xC5, 0x3A, 0x76, 0x61, 0x98, 0x71, 0xDC, 0x58, 0x67, 0x09, 0x71, 0x88, 0x51, 0x33,
+  0xA5, 0x26, 0x5B, 0x94, 0x23, 0x0F, 0x7D, 0xE5, 0xA5, 0x65, 0xFD, 0x09, 0x5A, 0x2B, 0xE8, 0x5D,
+  0x4A, 0x32, 0xD9, 0xB8, 0x43, 0xD2, 0x73, 0xE5, 0x93, 0xB2, 0x07, 0x2B, 0xBB, 0xA1, 0xBF, 0xEA,
+  0x59, 0xFA, 0xFB, 0x36, 0xA9, 0x57, 0xE4, 0xF8, 0xB5, 0xF7, 0xE4, 0x1D, 0xC3, 0x8D, 0x8A, 0x76,
+  0x0E, 0xDE, 0x96, 0x6A, 0xF0, 0xC2, 0xDB, 0xE5, 0x48, 0x78, 0xCA, 0x2C, 0x43, 0xCA, 0x41, 0x6E,
+  0xA8, 0xEC, 0x47, 0x02, 0xA8, 0x41, 0x9E, 0xFA, 0xEF, 0x1A, 0xCE, 0x6A, 0x45, 0x2A, 0x22, 0x1F,
+  0x9D, 0x9A, 0x2C, 0x0C, 0x4D, 0xC7, 0x77, 0x65, 0x8A, 0x22, 0xEB, 0x11, 0x70, 0xAA, 0x28, 0xB2,
+  0xC4, 0x14, 0xAA, 0x73, 0xC1, 0xF1, 0x9A, 0x58, 0x0F, 0x5A, 0x15, 0xBE, 0xE9, 0x63, 0x85, 0x31,
+  0x65, 0x73, 0xEC, 0x72, 0xE1, 0x0F, 0xF4, 0x41, 0x4C, 0x23, 0x8C, 0x7A, 0x98, 0x75, 0x10, 0x60,
+  0x88, 0x83, 0x5C, 0x42, 0x88, 0x15, 0x43, 0x44, 0x42, 0x88, 0xCC, 0x59, 0x34, 0xB5, 0x44, 0x80,
+  0x7F, 0x89, 0x41, 0x0E, 0x8C, 0x18, 0x63, 0x99, 0xBE, 0x8B, 0xF1, 0x4F, 0x10, 0xBA, 0x8B, 0x71,
+  0xCF, 0x4C, 0x62, 0x82, 0x70, 0x58, 0x09, 0x0C, 0x51, 0x49, 0x06, 0x4B, 0x4C, 0x27, 0x01, 0x13,
+  0xF8, 0x26, 0x17, 0x24, 0x4C, 0x64, 0x80, 0x2B, 0x92, 0x10, 0x73, 0x02, 0xD5, 0x8F, 0xEB, 0x0F,
+  0xA7, 0x75, 0x9F, 0xFD, 0x2D, 0x5A, 0x1A, 0x8F, 0x25, 0x22, 0xE7, 0xF5, 0xEE, 0x4B, 0x89, 0x74,
+  0xA6, 0xCA, 0xFA, 0x49, 0x45, 0xE4, 0x08, 0xDC, 0x7A, 0x47, 0x99, 0xA3, 0x2F, 0xD9, 0x05, 0x5D,
+  0x37, 0x90, 0xCB, 0x29, 0x7B, 0x8D, 0x15, 0x4A, 0x2B, 0x97, 0x0F, 0x23, 0x98, 0xAB, 0xA1, 0xB2,
+  0x8A, 0x79, 0x55, 0xE6, 0x71, 0x29, 0x1E, 0x1F, 0x33, 0xB8, 0xAE, 0x04, 0x7E, 0x99, 0xD5, 0x2A,
+  0x6A, 0x78, 0xC9, 0xF2, 0x7A, 0x47, 0x66, 0x2C, 0xEC, 0xFE, 0x0B, 0xE2, 0x3B, 0xC5, 0x63, 0xCC,
+  0x1A, 0x00, 0x00
+};
+
+#endif
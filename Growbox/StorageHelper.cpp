@@ -12,11 +12,14 @@
 
 // private:
 
-const word StorageHelperClass::LOG_CAPACITY_ARDUINO = (EEPROM.getCapacity() - sizeof(BootRecord)) / sizeof(LogRecord);
-const word StorageHelperClass::LOG_CAPACITY_AT24C32 = (EEPROM_AT24C32.getCapacity()) / sizeof(LogRecord);
+const word StorageHelperClass::LOG_BLOCKS_ARDUINO = (EEPROM.getCapacity() - sizeof(BootRecord) - sizeof(LogDayIndex)) / LOG_BLOCK_SIZE;
+const word StorageHelperClass::LOG_BLOCKS_AT24C32 = (EEPROM_AT24C32.getCapacity()) / LOG_BLOCK_SIZE;
+const word StorageHelperClass::LOG_DAY_INDEX_ADDRESS = EEPROM.getCapacity() - sizeof(LogDayIndex);
 
 StorageHelperClass::StorageHelperClass() :
-    c_isConfigurationLoaded(false) {
+    c_isConfigurationLoaded(false), c_logHeadBlock(0), c_isLogHeadRestored(false), c_logEpoch(0), c_logHeadOffset(0), c_lastLogRecordTimeStamp(0), c_logRecordsCount(LOG_RECORDS_COUNT_UNKNOWN),
+    c_lastLogDay(), c_lastLogDayPosition(LOG_DAY_INDEX_NO_POSITION), c_isLastLogDayDirty(false),
+    c_bootRecordCache(), c_bootRecordCacheDirtyFlags(0), c_storageStatistics() {
 }
 
 boolean StorageHelperClass::isBoolRecordCorrect(BootRecord& bootRecord) {
@@ -30,21 +33,48 @@ void StorageHelperClass::setBootRecord(BootRecord bootRecord) {
   EEPROM.updateBlock<BootRecord>(0, bootRecord);
 }
 BootRecord::BoolPreferencies StorageHelperClass::getBoolPreferencies() {
-  return EEPROM.readBlock<BootRecord::BoolPreferencies>(OFFSETOF(BootRecord, boolPreferencies));
+  return c_bootRecordCache.boolPreferencies;
 }
 
 void StorageHelperClass::setBoolPreferencies(BootRecord::BoolPreferencies boolPreferencies) {
-  EEPROM.updateBlock<BootRecord::BoolPreferencies>(OFFSETOF(BootRecord, boolPreferencies), boolPreferencies);
+  c_bootRecordCache.boolPreferencies = boolPreferencies;
+  c_bootRecordCacheDirtyFlags |= BOOT_RECORD_CACHE_DIRTY_BOOL_PREFERENCIES;
+}
+
+void StorageHelperClass::loadBootRecordCache(const BootRecord& bootRecord) {
+  c_bootRecordCache.boolPreferencies = bootRecord.boolPreferencies;
+  c_bootRecordCache.turnToDayModeAt = bootRecord.turnToDayModeAt;
+  c_bootRecordCache.turnToNightModeAt = bootRecord.turnToNightModeAt;
+  c_bootRecordCache.normalTemperatureDayMin = bootRecord.normalTemperatureDayMin;
+  c_bootRecordCache.normalTemperatureDayMax = bootRecord.normalTemperatureDayMax;
+  c_bootRecordCache.normalTemperatureNightMin = bootRecord.normalTemperatureNightMin;
+  c_bootRecordCache.normalTemperatureNightMax = bootRecord.normalTemperatureNightMax;
+  c_bootRecordCache.criticalTemperatureMax = bootRecord.criticalTemperatureMax;
+  c_bootRecordCache.criticalTemperatureMin = bootRecord.criticalTemperatureMin;
+  for (byte i = 0; i < MAX_WATERING_SYSTEMS_COUNT; i++) {
+    c_bootRecordCache.wateringSystemPreferencies[i] = bootRecord.wateringSystemPreferencies[i];
+  }
+  c_bootRecordCache.autoAdjustClockTimeDelta = bootRecord.autoAdjustClockTimeDelta;
+  c_bootRecordCache.fanSpeedDayColdTemperature = bootRecord.fanSpeedDayColdTemperature;
+  c_bootRecordCache.fanSpeedDayNormalTemperature = bootRecord.fanSpeedDayNormalTemperature;
+  c_bootRecordCache.fanSpeedDayHotTemperature = bootRecord.fanSpeedDayHotTemperature;
+  c_bootRecordCache.fanSpeedNightColdTemperature = bootRecord.fanSpeedNightColdTemperature;
+  c_bootRecordCache.fanSpeedNightNormalTemperature = bootRecord.fanSpeedNightNormalTemperature;
+  c_bootRecordCache.fanSpeedNightHotTemperature = bootRecord.fanSpeedNightHotTemperature;
+  c_bootRecordCacheDirtyFlags = 0;
 }
 
 // public:
 
 time_t StorageHelperClass::init_getLastStoredTime() {
   // init was OK, loadConfiguration not call
+  unsigned long startMicros = micros();
   BootRecord bootRecord = getBootRecord();
   if (!isBoolRecordCorrect(bootRecord)) {
     return 0;
   }
+  loadBootRecordCache(bootRecord);
+  c_storageStatistics.bootRecordLoadTime = micros() - startMicros;
 
   // check last boot
   time_t lastStoredTime = getStartupTimeStamp();
@@ -58,13 +88,12 @@ time_t StorageHelperClass::init_getLastStoredTime() {
   }
 
   // check last log record
-  word logRecordIndex = getLogRecordsCount() - 1;
-  if (logRecordIndex > 0) {
-    LogRecord logRecord = getLogRecordByIndex(logRecordIndex);
+  if (isLogDayIndexCorrect()) { // log stored in another format can't be read
+    restoreLogHead();
 
     // If No External EEPROM zero value doesn't break this code
-    if (logRecord.timeStamp > lastStoredTime) {
-      lastStoredTime = logRecord.timeStamp;
+    if (c_lastLogRecordTimeStamp > lastStoredTime) {
+      lastStoredTime = c_lastLogRecordTimeStamp;
     }
   }
 
@@ -84,7 +113,7 @@ boolean StorageHelperClass::init_loadConfiguration(time_t currentTime) {
     bootRecord.first_magic = MAGIC_NUMBER;
     bootRecord.firstStartupTimeStamp = currentTime;
     bootRecord.startupTimeStamp = currentTime;
-    bootRecord.nextLogRecordIndex = 0;
+    bootRecord.notUsed = 0;
     bootRecord.boolPreferencies.isLogOverflow = false;
     bootRecord.boolPreferencies.isLoggerEnabled = true;
     bootRecord.boolPreferencies.isWifiStationMode = false; // Access point used by default
@@ -151,6 +180,13 @@ boolean StorageHelperClass::init_loadConfiguration(time_t currentTime) {
     setBootRecord(bootRecord);
     itWasRestart = false;
   }
+  loadBootRecordCache(bootRecord);
+  if (!itWasRestart || !isLogDayIndexCorrect()) {
+    resetStoredLog(); // log format could be changed by firmware update
+  }
+  else if (!c_isLogHeadRestored) {
+    restoreLogHead();
+  }
 
   c_isConfigurationLoaded = true;
   if (itWasRestart) {
@@ -175,6 +211,45 @@ boolean StorageHelperClass::check_AT24C32_EEPROM() {
   }
 }
 
+// Stores all changed cached fields, called from main loop and before reboot
+void StorageHelperClass::commitBootRecordCache() {
+  if (c_bootRecordCacheDirtyFlags == 0) {
+    return;
+  }
+  if (c_bootRecordCacheDirtyFlags & BOOT_RECORD_CACHE_DIRTY_BOOL_PREFERENCIES) {
+    EEPROM.updateBlock<BootRecord::BoolPreferencies>(OFFSETOF(BootRecord, boolPreferencies), c_bootRecordCache.boolPreferencies);
+  }
+  if (c_bootRecordCacheDirtyFlags & BOOT_RECORD_CACHE_DIRTY_DAY_NIGHT_TIME) {
+    EEPROM.updateBlock<word>(OFFSETOF(BootRecord, turnToDayModeAt), c_bootRecordCache.turnToDayModeAt);
+    EEPROM.updateBlock<word>(OFFSETOF(BootRecord, turnToNightModeAt), c_bootRecordCache.turnToNightModeAt);
+  }
+  if (c_bootRecordCacheDirtyFlags & BOOT_RECORD_CACHE_DIRTY_TEMPERATURE) {
+    EEPROM.updateBlock<byte>(OFFSETOF(BootRecord, normalTemperatureDayMin), c_bootRecordCache.normalTemperatureDayMin);
+    EEPROM.updateBlock<byte>(OFFSETOF(BootRecord, normalTemperatureDayMax), c_bootRecordCache.normalTemperatureDayMax);
+    EEPROM.updateBlock<byte>(OFFSETOF(BootRecord, normalTemperatureNightMin), c_bootRecordCache.normalTemperatureNightMin);
+    EEPROM.updateBlock<byte>(OFFSETOF(BootRecord, normalTemperatureNightMax), c_bootRecordCache.normalTemperatureNightMax);
+    EEPROM.updateBlock<byte>(OFFSETOF(BootRecord, criticalTemperatureMax), c_bootRecordCache.criticalTemperatureMax);
+    EEPROM.updateBlock<byte>(OFFSETOF(BootRecord, criticalTemperatureMin), c_bootRecordCache.criticalTemperatureMin);
+  }
+  for (byte i = 0; i < MAX_WATERING_SYSTEMS_COUNT; i++) {
+    if (c_bootRecordCacheDirtyFlags & (BOOT_RECORD_CACHE_DIRTY_WATERING_SYSTEM << i)) {
+      EEPROM.updateBlock<BootRecord::WateringSystemPreferencies>(OFFSETOF(BootRecord, wateringSystemPreferencies) + i * sizeof(BootRecord::WateringSystemPreferencies), c_bootRecordCache.wateringSystemPreferencies[i]);
+    }
+  }
+  if (c_bootRecordCacheDirtyFlags & BOOT_RECORD_CACHE_DIRTY_AUTO_ADJUST_CLOCK) {
+    EEPROM.updateBlock<int16_t>(OFFSETOF(BootRecord, autoAdjustClockTimeDelta), c_bootRecordCache.autoAdjustClockTimeDelta);
+  }
+  if (c_bootRecordCacheDirtyFlags & BOOT_RECORD_CACHE_DIRTY_FAN) {
+    EEPROM.updateBlock<byte>(OFFSETOF(BootRecord, fanSpeedDayColdTemperature), c_bootRecordCache.fanSpeedDayColdTemperature);
+    EEPROM.updateBlock<byte>(OFFSETOF(BootRecord, fanSpeedDayNormalTemperature), c_bootRecordCache.fanSpeedDayNormalTemperature);
+    EEPROM.updateBlock<byte>(OFFSETOF(BootRecord, fanSpeedDayHotTemperature), c_bootRecordCache.fanSpeedDayHotTemperature);
+    EEPROM.updateBlock<byte>(OFFSETOF(BootRecord, fanSpeedNightColdTemperature), c_bootRecordCache.fanSpeedNightColdTemperature);
+    EEPROM.updateBlock<byte>(OFFSETOF(BootRecord, fanSpeedNightNormalTemperature), c_bootRecordCache.fanSpeedNightNormalTemperature);
+    EEPROM.updateBlock<byte>(OFFSETOF(BootRecord, fanSpeedNightHotTemperature), c_bootRecordCache.fanSpeedNightHotTemperature);
+  }
+  c_bootRecordCacheDirtyFlags = 0;
+}
+
 // public:
 time_t StorageHelperClass::getFirstStartupTimeStamp() {
   return EEPROM.readBlock<time_t>(OFFSETOF(BootRecord, firstStartupTimeStamp));
@@ -196,9 +271,40 @@ void StorageHelperClass::resetFirmware() {
   EEPROM.updateBlock<word>(OFFSETOF(BootRecord, first_magic), 0x0000);
 }
 
+// New epoch differs from epochs of all other blocks, so they are not taken as written after reset
 void StorageHelperClass::resetStoredLog() {
-  EEPROM.updateBlock<word>(OFFSETOF(BootRecord, nextLogRecordIndex), 0x0000);
+  byte usedEpochs[256 / 8];
+  memset(usedEpochs, 0, sizeof(usedEpochs));
+  boolean isExternalPresent = check_AT24C32_EEPROM();
+  word blocksCount = getLogBlocksCount();
+  for (word block = 1; block < blocksCount; block++) {
+    if (block >= LOG_BLOCKS_ARDUINO && !isExternalPresent) {
+      break;
+    }
+    byte epoch = readLogBlockEpoch(block, isExternalPresent);
+    bitSet(usedEpochs[epoch / 8], epoch % 8);
+  }
+  byte epoch = c_logEpoch + 1;
+  while (bitRead(usedEpochs[epoch / 8], epoch % 8)) {
+    epoch++;
+  }
+  c_logEpoch = epoch;
+
+  setLogHeadBlock(0);
   setLogOverflow(false);
+
+  // First block without records
+  byte data[sizeof(LogBlockHeader) + 1];
+  ((LogBlockHeader*) data)->timeStamp = 0;
+  ((LogBlockHeader*) data)->epoch = c_logEpoch;
+  data[sizeof(LogBlockHeader)] = LOG_BLOCK_END_MARKER;
+  writeLogBlock(0, 0, data, sizeof(data));
+
+  c_logHeadOffset = sizeof(LogBlockHeader);
+  c_lastLogRecordTimeStamp = 0;
+  c_logRecordsCount = 0;
+  c_isLogHeadRestored = true;
+  resetLogDayIndex();
 }
 
 void StorageHelperClass::setUseExternal_EEPROM_AT24C32(boolean useExternal) {
@@ -206,19 +312,30 @@ void StorageHelperClass::setUseExternal_EEPROM_AT24C32(boolean useExternal) {
   if (boolPreferencies.useExternal_EEPROM_AT24C32 == useExternal) {
     return;
   }
+  GB_Logger.flushLogRecords(); // pending records are stored to current log space
   boolPreferencies.useExternal_EEPROM_AT24C32 = useExternal;
   setBoolPreferencies(boolPreferencies);
 
   // Prepare log
   if (isLogOverflow()) {
-    setLogOverflow(false); // records 0..next => saved, next..arduinoCapacity => lost
+    setLogOverflow(false); // blocks 0..head => saved, head..arduinoCapacity => lost
   }
-  if (!useExternal) {
+  if (!useExternal && getLogHeadBlock() >= LOG_BLOCKS_ARDUINO) {
     // Decrease log space
-    // we cam use getLogRecordsCount() cause we already invoke setLogOverflow(false)
-    if (getLogRecordsCount() > LOG_CAPACITY_ARDUINO) {
-      resetStoredLog(); // last record can't be saved without move
+    resetStoredLog(); // last records can't be saved without move
+  }
+  else {
+    if (useExternal) {
+      // Old blocks of external EEPROM should not look like written after head one
+      boolean isExternalPresent = check_AT24C32_EEPROM();
+      for (word block = LOG_BLOCKS_ARDUINO; isExternalPresent && block < getLogBlocksCount(); block++) {
+        if (readLogBlockEpoch(block, isExternalPresent) == c_logEpoch) {
+          writeLogBlockEpoch(block, c_logEpoch - 1);
+        }
+      }
     }
+    loadLogHead();
+    rebuildLogDayIndex();
   }
 }
 
@@ -251,21 +368,24 @@ boolean StorageHelperClass::isAutoCalculatedClockTimeUsed() {
 }
 
 void StorageHelperClass::setAutoAdjustClockTimeDelta(int16_t delta) {
-  EEPROM.writeBlock<int16_t>(OFFSETOF(BootRecord, autoAdjustClockTimeDelta), delta);
+  c_bootRecordCache.autoAdjustClockTimeDelta = delta;
+  c_bootRecordCacheDirtyFlags |= BOOT_RECORD_CACHE_DIRTY_AUTO_ADJUST_CLOCK;
 }
 int16_t StorageHelperClass::getAutoAdjustClockTimeDelta() {
-  return EEPROM.readBlock<int16_t>(OFFSETOF(BootRecord, autoAdjustClockTimeDelta));
+  return c_bootRecordCache.autoAdjustClockTimeDelta;
 }
 
 void StorageHelperClass::getTurnToDayAndNightTime(word& upTime, word& downTime) {
-  upTime = EEPROM.readBlock<word>(OFFSETOF(BootRecord, turnToDayModeAt));
-  downTime = EEPROM.readBlock<word>(OFFSETOF(BootRecord, turnToNightModeAt));
+  upTime = c_bootRecordCache.turnToDayModeAt;
+  downTime = c_bootRecordCache.turnToNightModeAt;
 }
 void StorageHelperClass::setTurnToDayModeTime(const byte upHour, const byte upMinute) {
-  EEPROM.writeBlock<word>(OFFSETOF(BootRecord, turnToDayModeAt), upHour * 60 + upMinute);
+  c_bootRecordCache.turnToDayModeAt = upHour * 60 + upMinute;
+  c_bootRecordCacheDirtyFlags |= BOOT_RECORD_CACHE_DIRTY_DAY_NIGHT_TIME;
 }
 void StorageHelperClass::setTurnToNightModeTime(const byte downHour, const byte downMinute) {
-  EEPROM.writeBlock<word>(OFFSETOF(BootRecord, turnToNightModeAt), downHour * 60 + downMinute);
+  c_bootRecordCache.turnToNightModeAt = downHour * 60 + downMinute;
+  c_bootRecordCacheDirtyFlags |= BOOT_RECORD_CACHE_DIRTY_DAY_NIGHT_TIME;
 }
 
 /////////////////////////////////////////////////////////////////////
@@ -285,61 +405,73 @@ void StorageHelperClass::getTemperatureParameters(
     byte& normalTemperatueDayMin, byte& normalTemperatueDayMax,
     byte& normalTemperatueNightMin, byte& normalTemperatueNightMax,
     byte& criticalTemperatueMin, byte& criticalTemperatueMax) {
-  normalTemperatueDayMin   = EEPROM.readBlock<byte>(OFFSETOF(BootRecord, normalTemperatureDayMin));
-  normalTemperatueDayMax   = EEPROM.readBlock<byte>(OFFSETOF(BootRecord, normalTemperatureDayMax));
-  normalTemperatueNightMin = EEPROM.readBlock<byte>(OFFSETOF(BootRecord, normalTemperatureNightMin));
-  normalTemperatueNightMax = EEPROM.readBlock<byte>(OFFSETOF(BootRecord, normalTemperatureNightMax));
-  criticalTemperatueMin    = EEPROM.readBlock<byte>(OFFSETOF(BootRecord, criticalTemperatureMin));
-  criticalTemperatueMax    = EEPROM.readBlock<byte>(OFFSETOF(BootRecord, criticalTemperatureMax));
+  normalTemperatueDayMin   = c_bootRecordCache.normalTemperatureDayMin;
+  normalTemperatueDayMax   = c_bootRecordCache.normalTemperatureDayMax;
+  normalTemperatueNightMin = c_bootRecordCache.normalTemperatureNightMin;
+  normalTemperatueNightMax = c_bootRecordCache.normalTemperatureNightMax;
+  criticalTemperatueMin    = c_bootRecordCache.criticalTemperatureMin;
+  criticalTemperatueMax    = c_bootRecordCache.criticalTemperatureMax;
 }
 
 void StorageHelperClass::setNormalTemperatueDayMin(const byte normalTemperatueDayMin) {
-  EEPROM.writeBlock<byte>(OFFSETOF(BootRecord, normalTemperatureDayMin), normalTemperatueDayMin);
+  c_bootRecordCache.normalTemperatureDayMin = normalTemperatueDayMin;
+  c_bootRecordCacheDirtyFlags |= BOOT_RECORD_CACHE_DIRTY_TEMPERATURE;
 }
 void StorageHelperClass::setNormalTemperatueDayMax(const byte normalTemperatueDayMax) {
-  EEPROM.writeBlock<byte>(OFFSETOF(BootRecord, normalTemperatureDayMax), normalTemperatueDayMax);
+  c_bootRecordCache.normalTemperatureDayMax = normalTemperatueDayMax;
+  c_bootRecordCacheDirtyFlags |= BOOT_RECORD_CACHE_DIRTY_TEMPERATURE;
 }
 void StorageHelperClass::setNormalTemperatueNightMin(const byte normalTemperatueNightMin) {
-  EEPROM.writeBlock<byte>(OFFSETOF(BootRecord, normalTemperatureNightMin), normalTemperatueNightMin);
+  c_bootRecordCache.normalTemperatureNightMin = normalTemperatueNightMin;
+  c_bootRecordCacheDirtyFlags |= BOOT_RECORD_CACHE_DIRTY_TEMPERATURE;
 }
 void StorageHelperClass::setNormalTemperatueNightMax(const byte normalTemperatueNightMax) {
-  EEPROM.writeBlock<byte>(OFFSETOF(BootRecord, normalTemperatureNightMax), normalTemperatueNightMax);
+  c_bootRecordCache.normalTemperatureNightMax = normalTemperatueNightMax;
+  c_bootRecordCacheDirtyFlags |= BOOT_RECORD_CACHE_DIRTY_TEMPERATURE;
 }
 void StorageHelperClass::setCriticalTemperatueMin(const byte criticalTemperatueMin) {
-  EEPROM.writeBlock<byte>(OFFSETOF(BootRecord, criticalTemperatureMin), criticalTemperatueMin);
+  c_bootRecordCache.criticalTemperatureMin = criticalTemperatueMin;
+  c_bootRecordCacheDirtyFlags |= BOOT_RECORD_CACHE_DIRTY_TEMPERATURE;
 }
 void StorageHelperClass::setCriticalTemperatueMax(const byte criticalTemperatueMax) {
-  EEPROM.writeBlock<byte>(OFFSETOF(BootRecord, criticalTemperatureMax), criticalTemperatueMax);
+  c_bootRecordCache.criticalTemperatureMax = criticalTemperatueMax;
+  c_bootRecordCacheDirtyFlags |= BOOT_RECORD_CACHE_DIRTY_TEMPERATURE;
 }
 
 void StorageHelperClass::getFanParameters(
     byte& fanSpeedDayColdTemperature, byte& fanSpeedDayNormalTemperature, byte& fanSpeedDayHotTemperature,
     byte& fanSpeedNightColdTemperature, byte& fanSpeedNightNormalTemperature, byte& fanSpeedNightHotTemperature) {
-  fanSpeedDayColdTemperature     = EEPROM.readBlock<byte>(OFFSETOF(BootRecord, fanSpeedDayColdTemperature));
-  fanSpeedDayNormalTemperature   = EEPROM.readBlock<byte>(OFFSETOF(BootRecord, fanSpeedDayNormalTemperature));
-  fanSpeedDayHotTemperature      = EEPROM.readBlock<byte>(OFFSETOF(BootRecord, fanSpeedDayHotTemperature));
-  fanSpeedNightColdTemperature   = EEPROM.readBlock<byte>(OFFSETOF(BootRecord, fanSpeedNightColdTemperature));
-  fanSpeedNightNormalTemperature = EEPROM.readBlock<byte>(OFFSETOF(BootRecord, fanSpeedNightNormalTemperature));
-  fanSpeedNightHotTemperature    = EEPROM.readBlock<byte>(OFFSETOF(BootRecord, fanSpeedNightHotTemperature));
+  fanSpeedDayColdTemperature     = c_bootRecordCache.fanSpeedDayColdTemperature;
+  fanSpeedDayNormalTemperature   = c_bootRecordCache.fanSpeedDayNormalTemperature;
+  fanSpeedDayHotTemperature      = c_bootRecordCache.fanSpeedDayHotTemperature;
+  fanSpeedNightColdTemperature   = c_bootRecordCache.fanSpeedNightColdTemperature;
+  fanSpeedNightNormalTemperature = c_bootRecordCache.fanSpeedNightNormalTemperature;
+  fanSpeedNightHotTemperature    = c_bootRecordCache.fanSpeedNightHotTemperature;
 }
 
 void StorageHelperClass::setFanSpeedDayColdTemperature(const byte fanSpeedDayColdTemperature) {
-  EEPROM.writeBlock<byte>(OFFSETOF(BootRecord, fanSpeedDayColdTemperature), fanSpeedDayColdTemperature);
+  c_bootRecordCache.fanSpeedDayColdTemperature = fanSpeedDayColdTemperature;
+  c_bootRecordCacheDirtyFlags |= BOOT_RECORD_CACHE_DIRTY_FAN;
 }
 void StorageHelperClass::setFanSpeedDayNormalTemperature(const byte fanSpeedDayNormalTemperature) {
-  EEPROM.writeBlock<byte>(OFFSETOF(BootRecord, fanSpeedDayNormalTemperature), fanSpeedDayNormalTemperature);
+  c_bootRecordCache.fanSpeedDayNormalTemperature = fanSpeedDayNormalTemperature;
+  c_bootRecordCacheDirtyFlags |= BOOT_RECORD_CACHE_DIRTY_FAN;
 }
 void StorageHelperClass::setFanSpeedDayHotTemperature(const byte fanSpeedDayHotTemperature) {
-  EEPROM.writeBlock<byte>(OFFSETOF(BootRecord, fanSpeedDayHotTemperature), fanSpeedDayHotTemperature);
+  c_bootRecordCache.fanSpeedDayHotTemperature = fanSpeedDayHotTemperature;
+  c_bootRecordCacheDirtyFlags |= BOOT_RECORD_CACHE_DIRTY_FAN;
 }
 void StorageHelperClass::setFanSpeedNightColdTemperature(const byte fanSpeedNightColdTemperature) {
-  EEPROM.writeBlock<byte>(OFFSETOF(BootRecord, fanSpeedNightColdTemperature), fanSpeedNightColdTemperature);
+  c_bootRecordCache.fanSpeedNightColdTemperature = fanSpeedNightColdTemperature;
+  c_bootRecordCacheDirtyFlags |= BOOT_RECORD_CACHE_DIRTY_FAN;
 }
 void StorageHelperClass::setFanSpeedNightNormalTemperature(const byte fanSpeedNightNormalTemperature) {
-  EEPROM.writeBlock<byte>(OFFSETOF(BootRecord, fanSpeedNightNormalTemperature), fanSpeedNightNormalTemperature);
+  c_bootRecordCache.fanSpeedNightNormalTemperature = fanSpeedNightNormalTemperature;
+  c_bootRecordCacheDirtyFlags |= BOOT_RECORD_CACHE_DIRTY_FAN;
 }
 void StorageHelperClass::setFanSpeedNightHotTemperature(const byte fanSpeedNightHotTemperature) {
-  EEPROM.writeBlock<byte>(OFFSETOF(BootRecord, fanSpeedNightHotTemperature), fanSpeedNightHotTemperature);
+  c_bootRecordCache.fanSpeedNightHotTemperature = fanSpeedNightHotTemperature;
+  c_bootRecordCacheDirtyFlags |= BOOT_RECORD_CACHE_DIRTY_FAN;
 }
 
 /////////////////////////////////////////////////////////////////////
@@ -385,6 +517,7 @@ void StorageHelperClass::setStoreLogRecordsEnabled(boolean flag) {
   boolean isEnabled = (!boolPreferencies.isLoggerEnabled && flag);
   if (!isEnabled) {
     GB_Logger.logEvent(EVENT_LOGGER_DISABLED);
+    GB_Logger.flushLogRecords(); // store event while logger is enabled
   }
   boolPreferencies.isLoggerEnabled = flag;
   setBoolPreferencies(boolPreferencies);
@@ -397,32 +530,88 @@ boolean StorageHelperClass::isStoreLogRecordsEnabled() {
   return getBoolPreferencies().isLoggerEnabled;
 }
 
-boolean StorageHelperClass::storeLogRecord(LogRecord &logRecord) {
-  boolean storeLog = c_isConfigurationLoaded && isStoreLogRecordsEnabled();
-  if (!storeLog) {
-    return false;
+boolean StorageHelperClass::canStoreLogRecords() {
+  return c_isConfigurationLoaded && isStoreLogRecordsEnabled();
+}
+
+// Appends records to head block, new block is started when record doesn't fit or its
+// time delta can't be stored. Each block is written once per call. Returns count of stored records
+byte StorageHelperClass::storeLogRecords(const LogRecord logRecords[], byte logRecordsCount) {
+  if (!canStoreLogRecords()) {
+    return 0;
   }
-  word nextLogRecordIndex = getNextLogRecordIndex();
-  if (nextLogRecordIndex < LOG_CAPACITY_ARDUINO) {
-    word address = sizeof(BootRecord) + nextLogRecordIndex * sizeof(logRecord);
-    EEPROM.updateBlock<LogRecord>(address, logRecord);
+  word block = getLogHeadBlock();
+  if (block >= LOG_BLOCKS_ARDUINO && !check_AT24C32_EEPROM()) {
+    return 0;
   }
-  else {
-    if (!check_AT24C32_EEPROM()) {
-      return false;
+
+  unsigned long startMicros = micros();
+  byte data[LOG_BLOCK_SIZE];
+  byte offset = c_logHeadOffset; // end of records in block
+  byte writeOffset = offset;     // start of not written data
+  byte storedCount = 0;
+  for (; storedCount < logRecordsCount; storedCount++) {
+    const LogRecord& logRecord = logRecords[storedCount];
+    byte record[LOG_RECORD_MAX_SIZE];
+    byte sizeofRecord = 0;
+    if (offset > sizeof(LogBlockHeader)) {
+      sizeofRecord = encodeLogRecord(logRecord, c_lastLogRecordTimeStamp, record);
+      if (offset + sizeofRecord > LOG_BLOCK_SIZE) {
+        sizeofRecord = 0;
+      }
+    }
+
+    if (sizeofRecord == 0) { // new block
+      word newBlock = block;
+      if (offset > sizeof(LogBlockHeader)) {
+        newBlock = getNextLogBlock(block);
+      }
+      if (newBlock >= LOG_BLOCKS_ARDUINO && !check_AT24C32_EEPROM()) {
+        break;
+      }
+      flushLogBlock(block, data, writeOffset, offset);
+      if (newBlock != block) {
+        commitLogDayIndex(); // once per completed block
+        if (newBlock == 0) {
+          setLogOverflow(true);
+          c_logEpoch++;
+        }
+        if (isLogOverflow()) {
+          removeLogBlock(newBlock); // oldest block is overwritten
+        }
+        block = newBlock;
+        setLogHeadBlock(block);
+      }
+      ((LogBlockHeader*) data)->timeStamp = logRecord.timeStamp;
+      ((LogBlockHeader*) data)->epoch = c_logEpoch;
+      offset = sizeof(LogBlockHeader);
+      writeOffset = 0;
+      sizeofRecord = encodeLogRecord(logRecord, logRecord.timeStamp, record);
     }
-    word address = (nextLogRecordIndex - LOG_CAPACITY_ARDUINO) * sizeof(logRecord);
-    EEPROM_AT24C32.updateBlock<LogRecord>(address, logRecord);
+
+    memcpy(data + offset, record, sizeofRecord);
+    word recordPosition = block * LOG_BLOCK_SIZE + offset;
+    offset += sizeofRecord;
+    c_logHeadOffset = offset;
+
+    if (c_logRecordsCount != LOG_RECORDS_COUNT_UNKNOWN) {
+      c_logRecordsCount++;
+    }
+    addToLogDayIndex(recordPosition, logRecord);
   }
-  increaseNextLogRecordIndex();
-  return true;
+  flushLogBlock(block, data, writeOffset, offset);
+
+  c_storageStatistics.logStoreTime += micros() - startMicros;
+  c_storageStatistics.logStoredRecordsCount += storedCount;
+  return storedCount;
 }
 
 // private:
+
+// Stored at once, not with boot record cache: flag should match epochs of written blocks after power cut
 void StorageHelperClass::setLogOverflow(boolean flag) {
-  BootRecord::BoolPreferencies boolPreferencies = getBoolPreferencies();
-  boolPreferencies.isLogOverflow = flag;
-  setBoolPreferencies(boolPreferencies);
+  c_bootRecordCache.boolPreferencies.isLogOverflow = flag;
+  EEPROM.updateBlock<BootRecord::BoolPreferencies>(OFFSETOF(BootRecord, boolPreferencies), c_bootRecordCache.boolPreferencies);
 }
 
 // public:
@@ -430,66 +619,673 @@ boolean StorageHelperClass::isLogOverflow() {
   return getBoolPreferencies().isLogOverflow;
 }
 
+// Records have different size, so capacity is estimated
 word StorageHelperClass::getLogRecordsCapacity() {
-  word capacity = LOG_CAPACITY_ARDUINO;
+  return getLogBlocksCount() * ((LOG_BLOCK_SIZE - sizeof(LogBlockHeader)) / LOG_RECORD_TYPICAL_SIZE);
+}
+
+// Records are counted by log scan once, later count is updated on store
+word StorageHelperClass::getLogRecordsCount() {
+  if (c_logRecordsCount == LOG_RECORDS_COUNT_UNKNOWN) {
+    word logRecordsCount = 0;
+    LogRecordsCursor cursor;
+    LogRecord logRecord;
+    openLogRecordsCursor(cursor);
+    while (nextLogRecord(cursor, logRecord)) {
+      logRecordsCount++;
+    }
+    c_logRecordsCount = logRecordsCount;
+  }
+  return c_logRecordsCount;
+}
+
+// Count is known without log scan
+boolean StorageHelperClass::isLogRecordsCountKnown() {
+  return (c_logRecordsCount != LOG_RECORDS_COUNT_UNKNOWN);
+}
+
+// Records are decoded sequentially, use cursor for bulk reads
+LogRecord StorageHelperClass::getLogRecordByIndex(word index) {
+  LogRecordsCursor cursor;
+  LogRecord logRecord;
+  openLogRecordsCursor(cursor);
+  for (word i = 0; i <= index; i++) {
+    if (!nextLogRecord(cursor, logRecord)) {
+      return LogRecord(); // Empty
+    }
+  }
+  return logRecord;
+}
+
+// Cursor reads records [position..endPosition), from oldest record if position is not set, till newest
+// one if end position is not set
+void StorageHelperClass::openLogRecordsCursor(LogRecordsCursor& cursor, word position, word endPosition) {
+  if (position == LOG_POSITION_NONE) {
+    position = getOldestLogBlock() * LOG_BLOCK_SIZE + sizeof(LogBlockHeader);
+  }
+  cursor.blocksCount = getLogBlocksCount();
+  cursor.headBlock = getLogHeadBlock();
+  cursor.isExternalPresent = check_AT24C32_EEPROM();
+  cursor.position = position;
+  cursor.endPosition = endPosition;
+  cursor.recordPosition = LOG_POSITION_NONE;
+  cursor.timeStamp = 0;
+  cursor.isBlockLoaded = false;
+}
+
+// Returns false when all records were read. Position with zero offset is the end of full previous block,
+// block header is never decoded as records
+boolean StorageHelperClass::nextLogRecord(LogRecordsCursor& cursor, LogRecord& logRecord) {
+  while (cursor.position != cursor.endPosition) {
+    word block = cursor.position / LOG_BLOCK_SIZE;
+    byte offset = cursor.position % LOG_BLOCK_SIZE;
+    if (offset == 0) {
+      block--;
+      offset = LOG_BLOCK_SIZE;
+    }
+    if (block >= cursor.blocksCount) {
+      break;
+    }
+
+    if (!cursor.isBlockLoaded) {
+      readLogBlock(block, cursor.isExternalPresent, cursor.block);
+      cursor.isBlockLoaded = true;
+
+      // restore time stamp of previous record
+      cursor.timeStamp = ((LogBlockHeader*) cursor.block)->timeStamp;
+      byte skipOffset = sizeof(LogBlockHeader);
+      while (skipOffset < offset) {
+        byte skipSize = decodeLogRecord(cursor.block, skipOffset, cursor.timeStamp, logRecord);
+        if (skipSize == 0) {
+          break;
+        }
+        skipOffset += skipSize;
+      }
+    }
+
+    byte sizeofRecord = 0;
+    if (offset >= sizeof(LogBlockHeader)) {
+      sizeofRecord = decodeLogRecord(cursor.block, offset, cursor.timeStamp, logRecord);
+    }
+    if (sizeofRecord > 0) {
+      cursor.recordPosition = cursor.position;
+      cursor.position += sizeofRecord;
+      return true;
+    }
+
+    // end of block
+    if (block == cursor.headBlock) {
+      break;
+    }
+    block++;
+    if (block >= cursor.blocksCount) {
+      block = 0;
+    }
+    cursor.position = block * LOG_BLOCK_SIZE + sizeof(LogBlockHeader);
+    cursor.isBlockLoaded = false;
+  }
+  cursor.position = LOG_POSITION_NONE; // finished
+  return false;
+}
+
+// Opens cursor on first record with time stamp not less than given one. Returns false and opens cursor
+// on log end, if not found. Log is sorted by time only between clock changes. Day index is split on
+// clock set back, so binary search is done inside each day index record. Records older than day index
+// can have clock changes, they are scanned one by one
+boolean StorageHelperClass::findLogRecordByTime(LogRecordsCursor& cursor, time_t timeStamp) {
+  word day = elapsedDays(timeStamp);
+  byte logDaysCount = getLogDaysCount();
+
+  LogDayIndexRecord logDay;
+  word endPosition = LOG_POSITION_NONE;
+  word lastBlock = getLogHeadBlock();
+  if (logDaysCount > 0) {
+    logDay = getLogDayByIndex(0);
+    endPosition = logDay.firstLogRecordPosition;
+    lastBlock = endPosition / LOG_BLOCK_SIZE;
+  }
+  openLogRecordsCursor(cursor, LOG_POSITION_NONE, endPosition);
+  if (findLogRecordByTimeLinear(cursor, timeStamp)) {
+    return true;
+  }
+
+  for (byte logDayIndex = 0; logDayIndex < logDaysCount; logDayIndex++) {
+    LogDayIndexRecord nextLogDay;
+    endPosition = LOG_POSITION_NONE;
+    lastBlock = getLogHeadBlock();
+    if (logDayIndex + 1 < logDaysCount) {
+      nextLogDay = getLogDayByIndex(logDayIndex + 1);
+      endPosition = nextLogDay.firstLogRecordPosition;
+      lastBlock = endPosition / LOG_BLOCK_SIZE;
+    }
+    if (logDay.day >= day) {
+      openLogRecordsCursor(cursor, logDay.firstLogRecordPosition, endPosition);
+      if (logDay.day > day) {
+        return true;
+      }
+      if (findLogRecordByTimeInSequence(cursor, timeStamp, lastBlock)) {
+        return true;
+      }
+    }
+    logDay = nextLogDay;
+  }
+  openLogRecordsCursor(cursor, getLogHeadBlock() * LOG_BLOCK_SIZE + c_logHeadOffset);
+  return false;
+}
+
+// Token is epoch of position block and position. Block epoch is changed, when block is overwritten
+// by next log pass, so token lets external reader continue from position while its records exist.
+// Position with zero offset belongs to full previous block, see LogRecordsCursor
+unsigned long StorageHelperClass::getLogRecordsToken(word position) {
+  word block = position / LOG_BLOCK_SIZE;
+  if (position % LOG_BLOCK_SIZE == 0 && block > 0) {
+    block--;
+  }
+  byte epoch = readLogBlockEpoch(block, check_AT24C32_EEPROM());
+  return ((unsigned long) epoch << 16) | position;
+}
+
+// Opens cursor on position of token. Returns false, if records of token were overwritten, log was reset,
+// or token is wrong
+boolean StorageHelperClass::openLogRecordsCursorByToken(LogRecordsCursor& cursor, unsigned long token) {
+  word position = (word) token;
+  word block = position / LOG_BLOCK_SIZE;
+  byte offset = position % LOG_BLOCK_SIZE;
+  if (offset == 0) {
+    block--; // wrong block is rejected below
+    offset = LOG_BLOCK_SIZE;
+  }
+  if ((token >> 24) != 0 || offset < sizeof(LogBlockHeader)) {
+    return false;
+  }
+  openLogRecordsCursor(cursor, position);
+  if (block >= cursor.blocksCount || (block > cursor.headBlock && !isLogOverflow())) {
+    return false; // not written in current log pass
+  }
+  readLogBlock(block, cursor.isExternalPresent, cursor.block);
+  if (((LogBlockHeader*) cursor.block)->epoch != (byte) (token >> 16)) {
+    return false;
+  }
+
+  // position should be on record start or after last record of block
+  cursor.timeStamp = ((LogBlockHeader*) cursor.block)->timeStamp;
+  cursor.isBlockLoaded = true;
+  byte recordOffset = sizeof(LogBlockHeader);
+  LogRecord logRecord;
+  while (recordOffset < offset) {
+    byte sizeofRecord = decodeLogRecord(cursor.block, recordOffset, cursor.timeStamp, logRecord);
+    if (sizeofRecord == 0) {
+      break;
+    }
+    recordOffset += sizeofRecord;
+  }
+  return (recordOffset == offset);
+}
+
+// private:
+
+word StorageHelperClass::getLogHeadBlock() {
+  return c_logHeadBlock;
+}
+
+void StorageHelperClass::setLogHeadBlock(word block) {
+  c_logHeadBlock = block;
+}
+
+word StorageHelperClass::getLogBlocksCount() {
+  word blocksCount = LOG_BLOCKS_ARDUINO;
   if (isUseExternal_EEPROM_AT24C32()) {
-    capacity += LOG_CAPACITY_AT24C32;
+    blocksCount += LOG_BLOCKS_AT24C32;
   }
-  return capacity;
+  return blocksCount;
 }
 
-word StorageHelperClass::getLogRecordsCount() {
+// Oldest block is stored right after the head one, if log was overflowed
+word StorageHelperClass::getOldestLogBlock() {
   if (isLogOverflow()) {
-    return getLogRecordsCapacity();
+    return getNextLogBlock(getLogHeadBlock());
+  }
+  return 0;
+}
+
+word StorageHelperClass::getNextLogBlock(word block) {
+  block++;
+  if (block >= getLogBlocksCount()) {
+    block = 0;
+  }
+  return block;
+}
+
+// Head is last block with epoch of first block. Blocks of external EEPROM are not checked, if it is
+// disconnected
+void StorageHelperClass::restoreLogHead() {
+  unsigned long startMicros = micros();
+
+  boolean isExternalPresent = check_AT24C32_EEPROM();
+  word blocksCount = getLogBlocksCount();
+  if (!isExternalPresent) {
+    blocksCount = LOG_BLOCKS_ARDUINO;
+  }
+  c_logEpoch = readLogBlockEpoch(0, isExternalPresent);
+  word lowBlock = 0, highBlock = blocksCount;
+  while (lowBlock + 1 < highBlock) {
+    word middleBlock = (lowBlock + highBlock) / 2;
+    if (readLogBlockEpoch(middleBlock, isExternalPresent) == c_logEpoch) {
+      lowBlock = middleBlock;
+    }
+    else {
+      highBlock = middleBlock;
+    }
+  }
+  setLogHeadBlock(lowBlock);
+  loadLogHead();
+  c_isLogHeadRestored = true;
+
+  c_storageStatistics.logHeadRestoreTime = micros() - startMicros;
+}
+
+// Restores head offset and last record time stamp from head block
+void StorageHelperClass::loadLogHead() {
+  c_logRecordsCount = LOG_RECORDS_COUNT_UNKNOWN;
+  c_lastLogRecordTimeStamp = 0;
+
+  word block = getLogHeadBlock();
+  boolean isExternalPresent = check_AT24C32_EEPROM();
+  if (block >= LOG_BLOCKS_ARDUINO && !isExternalPresent) {
+    c_logHeadOffset = LOG_BLOCK_SIZE; // unknown, start next block
+    return;
+  }
+
+  byte data[LOG_BLOCK_SIZE];
+  readLogBlock(block, isExternalPresent, data);
+  time_t timeStamp = ((LogBlockHeader*) data)->timeStamp;
+  byte offset = sizeof(LogBlockHeader);
+  LogRecord logRecord;
+  while (true) {
+    byte sizeofRecord = decodeLogRecord(data, offset, timeStamp, logRecord);
+    if (sizeofRecord == 0) {
+      break;
+    }
+    offset += sizeofRecord;
+    c_lastLogRecordTimeStamp = timeStamp;
+  }
+  c_logHeadOffset = offset;
+}
+
+void StorageHelperClass::readLogBlock(word block, boolean isExternalPresent, byte data[]) {
+  if (block < LOG_BLOCKS_ARDUINO) {
+    EEPROM.readBlock<byte>(sizeof(BootRecord) + block * LOG_BLOCK_SIZE, data, LOG_BLOCK_SIZE);
+  }
+  else if (isExternalPresent) {
+    EEPROM_AT24C32.readBlock<byte>((block - LOG_BLOCKS_ARDUINO) * LOG_BLOCK_SIZE, data, LOG_BLOCK_SIZE);
   }
   else {
-    return getNextLogRecordIndex();
+    // Not loaded, block without records
+    ((LogBlockHeader*) data)->timeStamp = 0;
+    data[sizeof(LogBlockHeader)] = LOG_BLOCK_END_MARKER;
   }
 }
 
-LogRecord StorageHelperClass::getLogRecordByIndex(word index) {
-  if (index >= getLogRecordsCount()) {
-    return LogRecord(); // Empty
+time_t StorageHelperClass::readLogBlockTimeStamp(word block, boolean isExternalPresent) {
+  if (block < LOG_BLOCKS_ARDUINO) {
+    return EEPROM.readBlock<time_t>(sizeof(BootRecord) + block * LOG_BLOCK_SIZE);
+  }
+  else if (isExternalPresent) {
+    return EEPROM_AT24C32.readBlock<time_t>((block - LOG_BLOCKS_ARDUINO) * LOG_BLOCK_SIZE);
   }
+  return 0;
+}
 
-  word planeIndex = 0;
-  if (isLogOverflow()) {
-    planeIndex = getNextLogRecordIndex();
+byte StorageHelperClass::readLogBlockEpoch(word block, boolean isExternalPresent) {
+  if (block < LOG_BLOCKS_ARDUINO) {
+    return EEPROM.readBlock<byte>(sizeof(BootRecord) + block * LOG_BLOCK_SIZE + OFFSETOF(LogBlockHeader, epoch));
+  }
+  else if (isExternalPresent) {
+    return EEPROM_AT24C32.readBlock<byte>((block - LOG_BLOCKS_ARDUINO) * LOG_BLOCK_SIZE + OFFSETOF(LogBlockHeader, epoch));
+  }
+  return 0;
+}
+
+void StorageHelperClass::writeLogBlockEpoch(word block, byte epoch) {
+  writeLogBlock(block, OFFSETOF(LogBlockHeader, epoch), &epoch, sizeof(epoch));
+}
+
+// Writes data [fromOffset..toOffset) with end marker
+void StorageHelperClass::flushLogBlock(word block, byte data[], byte fromOffset, byte toOffset) {
+  if (toOffset <= fromOffset) {
+    return;
+  }
+  if (toOffset < LOG_BLOCK_SIZE) {
+    data[toOffset++] = LOG_BLOCK_END_MARKER;
+  }
+  writeLogBlock(block, fromOffset, data + fromOffset, toOffset - fromOffset);
+  c_storageStatistics.logWrittenBytesCount += toOffset - fromOffset;
+}
+
+void StorageHelperClass::writeLogBlock(word block, byte offset, const byte data[], byte sizeofData) {
+  if (block < LOG_BLOCKS_ARDUINO) {
+    EEPROM.updateBlock<byte>(sizeof(BootRecord) + block * LOG_BLOCK_SIZE + offset, data, sizeofData);
+  }
+  else {
+    // page write, no need to compare with overwritten data
+    EEPROM_AT24C32.writeBlock<byte>((block - LOG_BLOCKS_ARDUINO) * LOG_BLOCK_SIZE + offset, data, sizeofData);
   }
-  //Serial.print("logRecordOffset"); Serial.println(logRecordOffset);
-  planeIndex += index;
+}
 
-  //Serial.print("logRecordOffset"); Serial.println(logRecordOffset);
-  if (planeIndex >= getLogRecordsCapacity()) {
-    planeIndex -= getLogRecordsCapacity();
+// Returns size of encoded record, or zero if time delta can't be stored
+byte StorageHelperClass::encodeLogRecord(const LogRecord& logRecord, time_t previousTimeStamp, byte data[]) {
+  if (logRecord.timeStamp < previousTimeStamp || logRecord.timeStamp - previousTimeStamp > LOG_RECORD_LONG_DELTA_MAX) {
+    return 0;
   }
-  //Serial.print("logRecordOffset"); Serial.println(logRecordOffset);
-  if (planeIndex < LOG_CAPACITY_ARDUINO) {
-    return EEPROM.readBlock<LogRecord>(sizeof(BootRecord) + planeIndex * sizeof(LogRecord));
+  word delta = logRecord.timeStamp - previousTimeStamp;
+  byte size = 0;
+  data[size++] = logRecord.data;
+  if (delta <= LOG_RECORD_SHORT_DELTA_MAX) {
+    data[size++] = delta;
   }
   else {
-    if (!check_AT24C32_EEPROM()) {
-      return LogRecord(); // Empty
+    data[size++] = LOG_RECORD_LONG_DELTA | highByte(delta);
+    data[size++] = lowByte(delta);
+  }
+  if (logRecord.data1 != 0) {
+    data[1] |= LOG_RECORD_HAS_DATA1;
+    data[size++] = logRecord.data1;
+  }
+  return size;
+}
+
+// Returns size of decoded record, or zero at the end of block. Time stamp of previous record is updated
+byte StorageHelperClass::decodeLogRecord(const byte block[], byte offset, time_t& timeStamp, LogRecord& logRecord) {
+  if (offset + 2 > LOG_BLOCK_SIZE || block[offset] == LOG_BLOCK_END_MARKER) {
+    return 0;
+  }
+  byte control = block[offset + 1];
+  byte size = 2;
+  word delta = (control & LOG_RECORD_SHORT_DELTA_MAX);
+  if (control & LOG_RECORD_LONG_DELTA) {
+    if (offset + size >= LOG_BLOCK_SIZE) {
+      return 0;
+    }
+    delta = makeWord(delta, block[offset + size]);
+    size++;
+  }
+  logRecord.data1 = 0;
+  if (control & LOG_RECORD_HAS_DATA1) {
+    if (offset + size >= LOG_BLOCK_SIZE) {
+      return 0;
+    }
+    logRecord.data1 = block[offset + size];
+    size++;
+  }
+  timeStamp += delta;
+  logRecord.timeStamp = timeStamp;
+  logRecord.data = block[offset];
+  return size;
+}
+
+// Removes records of overwritten block from day index
+void StorageHelperClass::removeLogBlock(word block) {
+  byte data[LOG_BLOCK_SIZE];
+  readLogBlock(block, check_AT24C32_EEPROM(), data);
+
+  time_t timeStamp = ((LogBlockHeader*) data)->timeStamp;
+  byte offset = sizeof(LogBlockHeader);
+  LogRecord logRecord;
+  byte sizeofRecord = decodeLogRecord(data, offset, timeStamp, logRecord);
+  while (sizeofRecord > 0) {
+    LogRecord nextLogRecord;
+    byte nextOffset = offset + sizeofRecord;
+    byte nextSizeofRecord = decodeLogRecord(data, nextOffset, timeStamp, nextLogRecord);
+    word nextPosition = block * LOG_BLOCK_SIZE + nextOffset;
+    if (nextSizeofRecord == 0) {
+      nextPosition = getNextLogBlock(block) * LOG_BLOCK_SIZE + sizeof(LogBlockHeader);
     }
-    return EEPROM_AT24C32.readBlock<LogRecord>((planeIndex - LOG_CAPACITY_ARDUINO) * sizeof(LogRecord));
+
+    removeFromLogDayIndex(block * LOG_BLOCK_SIZE + offset, logRecord, nextPosition);
+    if (c_logRecordsCount != LOG_RECORDS_COUNT_UNKNOWN && c_logRecordsCount > 0) {
+      c_logRecordsCount--;
+    }
+
+    logRecord = nextLogRecord;
+    offset = nextOffset;
+    sizeofRecord = nextSizeofRecord;
+  }
+}
+
+// Binary search of block by its time stamp, then records are checked one by one.
+// Cursor should be opened on first record of sequence, its end position should be in last block
+boolean StorageHelperClass::findLogRecordByTimeInSequence(LogRecordsCursor& cursor, time_t timeStamp, word lastBlock) {
+  word firstBlock = cursor.position / LOG_BLOCK_SIZE;
+  word blocksCount = (lastBlock + cursor.blocksCount - firstBlock) % cursor.blocksCount;
+
+  // first block can contain records of previous sequence, last block - of next one
+  word lowBlock = 0, highBlock = blocksCount;
+  while (lowBlock + 1 < highBlock) {
+    word middleBlock = (lowBlock + highBlock) / 2;
+    if (readLogBlockTimeStamp((firstBlock + middleBlock) % cursor.blocksCount, cursor.isExternalPresent) < timeStamp) {
+      lowBlock = middleBlock;
+    }
+    else {
+      highBlock = middleBlock;
+    }
+  }
+  if (lowBlock > 0) {
+    cursor.position = ((firstBlock + lowBlock) % cursor.blocksCount) * LOG_BLOCK_SIZE + sizeof(LogBlockHeader);
+    cursor.isBlockLoaded = false;
+  }
+  return findLogRecordByTimeLinear(cursor, timeStamp);
+}
+
+// Records are checked one by one from cursor position
+boolean StorageHelperClass::findLogRecordByTimeLinear(LogRecordsCursor& cursor, time_t timeStamp) {
+  LogRecord logRecord;
+  LogRecordsCursor foundCursor = cursor;
+  while (nextLogRecord(cursor, logRecord)) {
+    if (logRecord.timeStamp >= timeStamp) {
+      cursor = foundCursor;
+      return true;
+    }
+    foundCursor = cursor;
+  }
+  return false;
+}
+
+/////////////////////////////////////////////////////////////////////
+//                            STATISTICS                           //
+/////////////////////////////////////////////////////////////////////
+
+// public:
+
+const StorageStatistics& StorageHelperClass::getStorageStatistics() {
+  return c_storageStatistics;
+}
+
+// Reads all log records, runs on user request only
+void StorageHelperClass::measureLogScanTime() {
+  unsigned long startMicros = micros();
+  word logRecordsCount = 0;
+  LogRecordsCursor cursor;
+  LogRecord logRecord;
+  openLogRecordsCursor(cursor);
+  while (nextLogRecord(cursor, logRecord)) {
+    logRecordsCount++;
+  }
+  c_storageStatistics.logScanTime = micros() - startMicros;
+  c_storageStatistics.logScannedRecordsCount = logRecordsCount;
+}
+
+/////////////////////////////////////////////////////////////////////
+//                          LOG DAY INDEX                          //
+/////////////////////////////////////////////////////////////////////
+
+// public:
+
+byte StorageHelperClass::getLogDaysCount() {
+  return EEPROM.readBlock<byte>(LOG_DAY_INDEX_ADDRESS + OFFSETOF(LogDayIndex, recordsCount));
+}
+
+LogDayIndexRecord StorageHelperClass::getLogDayByIndex(byte index) {
+  byte firstRecord = EEPROM.readBlock<byte>(LOG_DAY_INDEX_ADDRESS + OFFSETOF(LogDayIndex, firstRecord));
+  return readLogDayIndexRecord(firstRecord + index);
+}
+
+// Stores counters of newest day, called when head block is completed and before reboot
+void StorageHelperClass::commitLogDayIndex() {
+  if (!c_isLastLogDayDirty) {
+    return;
   }
+  EEPROM.updateBlock<LogDayIndexRecord>(getLogDayIndexRecordAddress(c_lastLogDayPosition), c_lastLogDay);
+  c_isLastLogDayDirty = false;
+}
+
+// private:
+
+// Log format version is stored in day index, both are changed together
+boolean StorageHelperClass::isLogDayIndexCorrect() {
+  return (EEPROM.readBlock<word>(LOG_DAY_INDEX_ADDRESS + OFFSETOF(LogDayIndex, magic)) == LOG_DAY_INDEX_MAGIC_NUMBER)
+      && (EEPROM.readBlock<byte>(LOG_DAY_INDEX_ADDRESS + OFFSETOF(LogDayIndex, logFormatVersion)) == LOG_FORMAT_VERSION);
 }
 
-// private :
+void StorageHelperClass::resetLogDayIndex() {
+  EEPROM.updateBlock<word>(LOG_DAY_INDEX_ADDRESS + OFFSETOF(LogDayIndex, magic), LOG_DAY_INDEX_MAGIC_NUMBER);
+  EEPROM.updateBlock<byte>(LOG_DAY_INDEX_ADDRESS + OFFSETOF(LogDayIndex, logFormatVersion), LOG_FORMAT_VERSION);
+  EEPROM.updateBlock<byte>(LOG_DAY_INDEX_ADDRESS + OFFSETOF(LogDayIndex, firstRecord), 0);
+  EEPROM.updateBlock<byte>(LOG_DAY_INDEX_ADDRESS + OFFSETOF(LogDayIndex, recordsCount), 0);
+  c_lastLogDayPosition = LOG_DAY_INDEX_NO_POSITION;
+  c_isLastLogDayDirty = false;
+}
+
+void StorageHelperClass::rebuildLogDayIndex() {
+  resetLogDayIndex();
 
-word StorageHelperClass::getNextLogRecordIndex() {
-  return EEPROM.readBlock<word>(OFFSETOF(BootRecord, nextLogRecordIndex));
+  LogRecordsCursor cursor;
+  openLogRecordsCursor(cursor);
+  LogRecord logRecord;
+  c_lastLogRecordTimeStamp = 0;
+  while (nextLogRecord(cursor, logRecord)) {
+    addToLogDayIndex(cursor.recordPosition, logRecord);
+  }
+  commitLogDayIndex();
 }
 
-void StorageHelperClass::increaseNextLogRecordIndex() {
-  word nextLogRecordIndex = getNextLogRecordIndex();
-  nextLogRecordIndex++;
-  if (nextLogRecordIndex >= getLogRecordsCapacity()) {
-    nextLogRecordIndex = 0;
+word StorageHelperClass::getLogDayIndexRecordAddress(byte position) {
+  return LOG_DAY_INDEX_ADDRESS + OFFSETOF(LogDayIndex, records) + (position % LOG_DAY_INDEX_CAPACITY) * sizeof(LogDayIndexRecord);
+}
+
+// Newest record is read from RAM copy, it can be not committed yet
+LogDayIndexRecord StorageHelperClass::readLogDayIndexRecord(byte position) {
+  position %= LOG_DAY_INDEX_CAPACITY;
+  if (position == c_lastLogDayPosition) {
+    return c_lastLogDay;
+  }
+  return EEPROM.readBlock<LogDayIndexRecord>(getLogDayIndexRecordAddress(position));
+}
 
-    setLogOverflow(true);
+void StorageHelperClass::writeLogDayIndexRecord(byte position, const LogDayIndexRecord& logDayIndexRecord) {
+  position %= LOG_DAY_INDEX_CAPACITY;
+  if (position == c_lastLogDayPosition) {
+    c_lastLogDay = logDayIndexRecord;
+    c_isLastLogDayDirty = true;
+    return;
+  }
+  EEPROM.updateBlock<LogDayIndexRecord>(getLogDayIndexRecordAddress(position), logDayIndexRecord);
+}
+
+void StorageHelperClass::changeLogDayIndexRecordCounter(LogDayIndexRecord& logDayIndexRecord, const LogRecord& logRecord, boolean increase) {
+  word* counter;
+  if (GB_Logger.isEvent(logRecord)) {
+    counter = &logDayIndexRecord.eventsCount;
+  }
+  else if (GB_Logger.isWateringEvent(logRecord)) {
+    counter = &logDayIndexRecord.wateringEventsCount;
+  }
+  else if (GB_Logger.isError(logRecord)) {
+    counter = &logDayIndexRecord.errorsCount;
+  }
+  else {
+    counter = &logDayIndexRecord.temperatureCount;
+  }
+  if (increase) {
+    (*counter)++;
+  }
+  else if (*counter > 0) {
+    (*counter)--;
+  }
+}
+
+void StorageHelperClass::addToLogDayIndex(word position, const LogRecord& logRecord) {
+  word day = elapsedDays(logRecord.timeStamp);
+  boolean isClockSetBack = (logRecord.timeStamp < c_lastLogRecordTimeStamp);
+  c_lastLogRecordTimeStamp = logRecord.timeStamp;
+
+  if (c_lastLogDayPosition == LOG_DAY_INDEX_NO_POSITION) {
+    byte recordsCount = EEPROM.readBlock<byte>(LOG_DAY_INDEX_ADDRESS + OFFSETOF(LogDayIndex, recordsCount));
+    if (recordsCount > 0) {
+      byte firstRecord = EEPROM.readBlock<byte>(LOG_DAY_INDEX_ADDRESS + OFFSETOF(LogDayIndex, firstRecord));
+      c_lastLogDayPosition = (firstRecord + recordsCount - 1) % LOG_DAY_INDEX_CAPACITY;
+      c_lastLogDay = EEPROM.readBlock<LogDayIndexRecord>(getLogDayIndexRecordAddress(c_lastLogDayPosition));
+    }
+  }
+  if (c_lastLogDayPosition != LOG_DAY_INDEX_NO_POSITION && c_lastLogDay.day == day && !isClockSetBack) {
+    changeLogDayIndexRecordCounter(c_lastLogDay, logRecord, true);
+    c_isLastLogDayDirty = true;
+    return;
+  }
+
+  // New day or clock was set back
+  commitLogDayIndex();
+  byte firstRecord = EEPROM.readBlock<byte>(LOG_DAY_INDEX_ADDRESS + OFFSETOF(LogDayIndex, firstRecord));
+  byte recordsCount = EEPROM.readBlock<byte>(LOG_DAY_INDEX_ADDRESS + OFFSETOF(LogDayIndex, recordsCount));
+  if (recordsCount == LOG_DAY_INDEX_CAPACITY) {
+    // Oldest day is lost from index, its records will be found by log scan
+    firstRecord = (firstRecord + 1) % LOG_DAY_INDEX_CAPACITY;
+    recordsCount--;
+  }
+  LogDayIndexRecord newDay;
+  newDay.day = day;
+  newDay.firstLogRecordPosition = position;
+  newDay.eventsCount = 0;
+  newDay.wateringEventsCount = 0;
+  newDay.errorsCount = 0;
+  newDay.temperatureCount = 0;
+  changeLogDayIndexRecordCounter(newDay, logRecord, true);
+  EEPROM.updateBlock<LogDayIndexRecord>(getLogDayIndexRecordAddress(firstRecord + recordsCount), newDay);
+  c_lastLogDay = newDay;
+  c_lastLogDayPosition = (firstRecord + recordsCount) % LOG_DAY_INDEX_CAPACITY;
+  c_isLastLogDayDirty = false;
+  recordsCount++;
+
+  EEPROM.updateBlock<byte>(LOG_DAY_INDEX_ADDRESS + OFFSETOF(LogDayIndex, firstRecord), firstRecord);
+  EEPROM.updateBlock<byte>(LOG_DAY_INDEX_ADDRESS + OFFSETOF(LogDayIndex, recordsCount), recordsCount);
+}
+
+// Called when oldest log record is overwritten
+void StorageHelperClass::removeFromLogDayIndex(word position, const LogRecord& logRecord, word nextPosition) {
+  byte firstRecord = EEPROM.readBlock<byte>(LOG_DAY_INDEX_ADDRESS + OFFSETOF(LogDayIndex, firstRecord));
+  byte recordsCount = EEPROM.readBlock<byte>(LOG_DAY_INDEX_ADDRESS + OFFSETOF(LogDayIndex, recordsCount));
+  if (recordsCount == 0) {
+    return;
+  }
+  LogDayIndexRecord oldestDay = readLogDayIndexRecord(firstRecord);
+  if (oldestDay.firstLogRecordPosition != position) {
+    return; // record is older than index
+  }
+
+  changeLogDayIndexRecordCounter(oldestDay, logRecord, false);
+  if (oldestDay.getLogRecordsCount() == 0) {
+    if (firstRecord % LOG_DAY_INDEX_CAPACITY == c_lastLogDayPosition) {
+      c_lastLogDayPosition = LOG_DAY_INDEX_NO_POSITION; // index is empty
+      c_isLastLogDayDirty = false;
+    }
+    firstRecord = (firstRecord + 1) % LOG_DAY_INDEX_CAPACITY;
+    recordsCount--;
+    EEPROM.updateBlock<byte>(LOG_DAY_INDEX_ADDRESS + OFFSETOF(LogDayIndex, firstRecord), firstRecord);
+    EEPROM.updateBlock<byte>(LOG_DAY_INDEX_ADDRESS + OFFSETOF(LogDayIndex, recordsCount), recordsCount);
+  }
+  else {
+    oldestDay.firstLogRecordPosition = nextPosition;
+    writeLogDayIndexRecord(firstRecord, oldestDay);
   }
-  EEPROM.updateBlock(OFFSETOF(BootRecord, nextLogRecordIndex), nextLogRecordIndex);
 }
 
 /////////////////////////////////////////////////////////////////////
@@ -548,14 +1344,15 @@ BootRecord::WateringSystemPreferencies StorageHelperClass::getWateringSystemPref
     // TODO add error to log
     return BootRecord::WateringSystemPreferencies();
   }
-  return EEPROM.readBlock<BootRecord::WateringSystemPreferencies>(OFFSETOF(BootRecord, wateringSystemPreferencies) + id * sizeof(BootRecord::WateringSystemPreferencies));
+  return c_bootRecordCache.wateringSystemPreferencies[id];
 }
 
 void StorageHelperClass::setWateringSystemPreferenciesById(byte id, BootRecord::WateringSystemPreferencies wateringSystemPreferencies) {
   if (id >= MAX_WATERING_SYSTEMS_COUNT) {
     return;
   }
-  EEPROM.updateBlock<BootRecord::WateringSystemPreferencies>(OFFSETOF(BootRecord, wateringSystemPreferencies) + id * sizeof(BootRecord::WateringSystemPreferencies), wateringSystemPreferencies);
+  c_bootRecordCache.wateringSystemPreferencies[id] = wateringSystemPreferencies;
+  c_bootRecordCacheDirtyFlags |= (BOOT_RECORD_CACHE_DIRTY_WATERING_SYSTEM << id);
 }
 
 StorageHelperClass GB_StorageHelper;
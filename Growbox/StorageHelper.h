@@ -3,13 +3,84 @@
 
 #include "StorageModel.h"
 
+const word LOG_POSITION_NONE = 0xFFFF;
+
+// Sequential reader of log. Log state is taken once on open, records are read by blocks.
+// Position is log block * LOG_BLOCK_SIZE + offset in block, zero offset means end of full previous block
+struct LogRecordsCursor{
+  word blocksCount;
+  word headBlock;
+  boolean isExternalPresent;
+  word position;             // position of next record
+  word endPosition;          // position to stop before, or LOG_POSITION_NONE
+  word recordPosition;       // position of last returned record
+  time_t timeStamp;          // time stamp of last decoded record in loaded block
+  boolean isBlockLoaded;
+  byte block[LOG_BLOCK_SIZE];
+};
+
+// Storage performance measured on board, times are in microseconds
+struct StorageStatistics{
+  unsigned long bootRecordLoadTime;
+  unsigned long logHeadRestoreTime;
+  unsigned long logStoreTime;        // total time of storeLogRecords() calls
+  unsigned long logStoredRecordsCount;
+  unsigned long logWrittenBytesCount;
+  unsigned long logScanTime;         // last full log scan, 0 if not measured
+  word logScannedRecordsCount;
+};
+
 class StorageHelperClass{
 
 private:
-  static const word LOG_CAPACITY_ARDUINO;
-  static const word LOG_CAPACITY_AT24C32;
+  static const word LOG_BLOCKS_ARDUINO;
+  static const word LOG_BLOCKS_AT24C32;
+  static const word LOG_DAY_INDEX_ADDRESS;
+
+  // RAM copy of frequently used BootRecord fields. Setters mark field as dirty,
+  // all dirty fields are stored to EEPROM by commitBootRecordCache()
+  struct BootRecordCache{
+    BootRecord::BoolPreferencies boolPreferencies;
+    word turnToDayModeAt;
+    word turnToNightModeAt;
+    byte normalTemperatureDayMin;
+    byte normalTemperatureDayMax;
+    byte normalTemperatureNightMin;
+    byte normalTemperatureNightMax;
+    byte criticalTemperatureMax;
+    byte criticalTemperatureMin;
+    BootRecord::WateringSystemPreferencies wateringSystemPreferencies[MAX_WATERING_SYSTEMS_COUNT];
+    int16_t autoAdjustClockTimeDelta;
+    byte fanSpeedDayColdTemperature;
+    byte fanSpeedDayNormalTemperature;
+    byte fanSpeedDayHotTemperature;
+    byte fanSpeedNightColdTemperature;
+    byte fanSpeedNightNormalTemperature;
+    byte fanSpeedNightHotTemperature;
+  };
+
+  enum BootRecordCacheDirtyFlag{
+    BOOT_RECORD_CACHE_DIRTY_BOOL_PREFERENCIES     = 0x0002,
+    BOOT_RECORD_CACHE_DIRTY_DAY_NIGHT_TIME        = 0x0004,
+    BOOT_RECORD_CACHE_DIRTY_TEMPERATURE           = 0x0008,
+    BOOT_RECORD_CACHE_DIRTY_AUTO_ADJUST_CLOCK     = 0x0010,
+    BOOT_RECORD_CACHE_DIRTY_FAN                   = 0x0020,
+    BOOT_RECORD_CACHE_DIRTY_WATERING_SYSTEM       = 0x0100 // first watering system, next ones use next bits
+  };
 
   boolean c_isConfigurationLoaded;
+  word c_logHeadBlock;             // restored by log scan, not stored
+  boolean c_isLogHeadRestored;     // head is restored once at boot
+  byte c_logEpoch;                 // epoch of head block
+  byte c_logHeadOffset;            // used bytes in head block
+  time_t c_lastLogRecordTimeStamp; // used for time delta and to detect clock set back
+  word c_logRecordsCount;          // LOG_RECORDS_COUNT_UNKNOWN until first request
+  LogDayIndexRecord c_lastLogDay;  // newest day index record, its counters are stored with completed head block
+  byte c_lastLogDayPosition;       // position in day index ring, LOG_DAY_INDEX_NO_POSITION if not loaded
+  boolean c_isLastLogDayDirty;
+  BootRecordCache c_bootRecordCache;
+  word c_bootRecordCacheDirtyFlags;
+  StorageStatistics c_storageStatistics;
 
   boolean isBoolRecordCorrect(BootRecord& bootRecord);
 
@@ -18,6 +89,8 @@ private:
   BootRecord::BoolPreferencies getBoolPreferencies();
   void setBoolPreferencies(BootRecord::BoolPreferencies boolPreferencies);
 
+  void loadBootRecordCache(const BootRecord& bootRecord);
+
 public:
   StorageHelperClass();
 
@@ -26,6 +99,8 @@ public:
 
   boolean check_AT24C32_EEPROM();
 
+  void commitBootRecordCache();
+
 public:
   time_t getFirstStartupTimeStamp();
   time_t getStartupTimeStamp();
@@ -104,7 +179,8 @@ public:
   void setStoreLogRecordsEnabled(boolean flag);
   boolean isStoreLogRecordsEnabled();
 
-  boolean storeLogRecord(LogRecord &logRecord);
+  boolean canStoreLogRecords();
+  byte storeLogRecords(const LogRecord logRecords[], byte logRecordsCount);
 
 private:
   void setLogOverflow(boolean flag);
@@ -114,12 +190,58 @@ public:
 
   word getLogRecordsCapacity();
   word getLogRecordsCount();
+  boolean isLogRecordsCountKnown();
   LogRecord getLogRecordByIndex(word index);
 
-private:
+  void openLogRecordsCursor(LogRecordsCursor& cursor, word position = LOG_POSITION_NONE, word endPosition = LOG_POSITION_NONE);
+  boolean nextLogRecord(LogRecordsCursor& cursor, LogRecord& logRecord);
+
+  boolean findLogRecordByTime(LogRecordsCursor& cursor, time_t timeStamp);
+
+  unsigned long getLogRecordsToken(word position);
+  boolean openLogRecordsCursorByToken(LogRecordsCursor& cursor, unsigned long token);
 
-  word getNextLogRecordIndex();
-  void increaseNextLogRecordIndex();
+  byte getLogDaysCount();
+  LogDayIndexRecord getLogDayByIndex(byte index);
+  void commitLogDayIndex();
+
+  const StorageStatistics& getStorageStatistics();
+  void measureLogScanTime();
+
+private:
+  static const word LOG_RECORDS_COUNT_UNKNOWN = 0xFFFF;
+  static const byte LOG_DAY_INDEX_NO_POSITION = 0xFF;
+
+  word getLogHeadBlock();
+  void setLogHeadBlock(word block);
+  word getLogBlocksCount();
+  word getOldestLogBlock();
+  word getNextLogBlock(word block);
+  void restoreLogHead();
+  void loadLogHead();
+
+  void readLogBlock(word block, boolean isExternalPresent, byte data[]);
+  time_t readLogBlockTimeStamp(word block, boolean isExternalPresent);
+  byte readLogBlockEpoch(word block, boolean isExternalPresent);
+  void writeLogBlockEpoch(word block, byte epoch);
+  void flushLogBlock(word block, byte data[], byte fromOffset, byte toOffset);
+  void writeLogBlock(word block, byte offset, const byte data[], byte sizeofData);
+  byte encodeLogRecord(const LogRecord& logRecord, time_t previousTimeStamp, byte data[]);
+  byte decodeLogRecord(const byte block[], byte offset, time_t& timeStamp, LogRecord& logRecord);
+  void removeLogBlock(word block);
+
+  boolean findLogRecordByTimeInSequence(LogRecordsCursor& cursor, time_t timeStamp, word lastBlock);
+  boolean findLogRecordByTimeLinear(LogRecordsCursor& cursor, time_t timeStamp);
+
+  boolean isLogDayIndexCorrect();
+  void resetLogDayIndex();
+  void rebuildLogDayIndex();
+  word getLogDayIndexRecordAddress(byte position);
+  LogDayIndexRecord readLogDayIndexRecord(byte position);
+  void writeLogDayIndexRecord(byte position, const LogDayIndexRecord& logDayIndexRecord);
+  void changeLogDayIndexRecordCounter(LogDayIndexRecord& logDayIndexRecord, const LogRecord& logRecord, boolean increase);
+  void addToLogDayIndex(word position, const LogRecord& logRecord);
+  void removeFromLogDayIndex(word position, const LogRecord& logRecord, word nextPosition);
 
 public:
   /////////////////////////////////////////////////////////////////////
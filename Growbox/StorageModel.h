@@ -14,7 +14,7 @@ struct BootRecord{
   word first_magic;                 //  2
   time_t firstStartupTimeStamp;     //  4
   time_t startupTimeStamp;          //  4
-  word nextLogRecordIndex;          //  2
+  word notUsed;                     //  2 was log head block, now head is restored by log scan
   struct BoolPreferencies{
     boolean isLogOverflow :1;
     boolean isLoggerEnabled :1;
@@ -99,5 +99,57 @@ struct LogRecord{
   }
 };
 
+// Log is stored in blocks. Block starts with time stamp of its first record and epoch of log pass,
+// next records store time delta from previous one. Record format is [DDDDDDDD][HLTTTTTT]([TTTTTTTT])([VVVVVVVV])
+//   DDDDDDDD - LogRecord.data
+//   H - LogRecord.data1 is stored in last byte
+//   L - long time delta, one more byte is used
+//   TTTTTT(TTTTTTTT) - time delta in seconds
+//   VVVVVVVV - LogRecord.data1
+// Zero data byte marks end of records in block
+const byte LOG_FORMAT_VERSION = 3;
+const byte LOG_BLOCK_SIZE = 32;                    // AT24C32 page size
+const byte LOG_BLOCK_END_MARKER = 0x00;            // Event with zero index is not used
+const byte LOG_RECORD_HAS_DATA1 = B10000000;
+const byte LOG_RECORD_LONG_DELTA = B01000000;
+const byte LOG_RECORD_SHORT_DELTA_MAX = B00111111; // 63 sec
+const word LOG_RECORD_LONG_DELTA_MAX = 0x3FFF;     // 16383 sec, about 4.5 hours
+const byte LOG_RECORD_MAX_SIZE = 4;
+const byte LOG_RECORD_TYPICAL_SIZE = 3;            // used for capacity estimation
+
+// Epoch is increased when log is wrapped to first block. Blocks from first till head one have
+// same epoch, other blocks have another one, so head block is found by binary search at boot
+struct LogBlockHeader{
+  time_t timeStamp;                 // 4
+  byte epoch;                       // 1
+};
+
+const word LOG_DAY_INDEX_MAGIC_NUMBER = 0xD1A5;
+const byte LOG_DAY_INDEX_CAPACITY = 16;
+
+// Sequence of log records with same day. Counters of newest day are stored once per log block,
+// so they can miss records of last block after power cut
+struct LogDayIndexRecord{
+  word day;                         // 2 days since 1970
+  word firstLogRecordPosition;      // 2 log block * LOG_BLOCK_SIZE + offset in block
+  word eventsCount;                 // 2
+  word wateringEventsCount;         // 2
+  word errorsCount;                 // 2
+  word temperatureCount;            // 2
+
+  word getLogRecordsCount() const {
+    return eventsCount + wateringEventsCount + errorsCount + temperatureCount;
+  }
+};
+
+// Stored at the end of Arduino EEPROM, after log records
+struct LogDayIndex{
+  word magic;                       //   2
+  byte logFormatVersion;            //   1
+  byte firstRecord;                 //   1 oldest day position in records ring
+  byte recordsCount;                //   1
+  LogDayIndexRecord records[LOG_DAY_INDEX_CAPACITY]; // 12*LOG_DAY_INDEX_CAPACITY(16) = 192
+};
+
 #endif
 
@@ -41,6 +41,10 @@ boolean StringUtils::flashStringEquals(const char* cstr, size_t cstr_length, con
   return (strncmp_P(cstr, ((const char*)fstr), cstr_length) == 0); // check this method
 }
 
+boolean StringUtils::flashStringEquals(const char* cstr, const __FlashStringHelper* fstr) {
+  return (strcmp_P(cstr, ((const char*)fstr)) == 0);
+}
+
 boolean StringUtils::flashStringStartsWith(const String &str, const __FlashStringHelper* fstr) {
   size_t length = flashStringLength(fstr);
   if (length > str.length()) {
@@ -19,6 +19,7 @@ namespace StringUtils {
 
   boolean flashStringEquals(const String &str, const __FlashStringHelper* fstr);
   boolean flashStringEquals(const char* cstr, size_t length, const __FlashStringHelper* fstr);
+  boolean flashStringEquals(const char* cstr, const __FlashStringHelper* fstr);
   boolean flashStringStartsWith(const String &str, const __FlashStringHelper* fstr);
   boolean flashStringStartsWith(const char* cstr, size_t cstr_length, const __FlashStringHelper* fstr);
   boolean flashStringEndsWith(const String &str, const __FlashStringHelper* pstr);
@@ -2,6 +2,7 @@
 #define WebServer_h
 
 #include "Global.h"
+#include "StorageModel.h"
 
 /////////////////////////////////////////////////////////////////////
 //                           HTML CONSTS                           //
@@ -17,17 +18,131 @@ const char S_URL_OTHER_PAGE[] PROGMEM = "/other";
 const char S_URL_DUMP_INTERNAL[] PROGMEM = "/other/dump_internal";
 const char S_URL_DUMP_AT24C32[] PROGMEM = "/other/dump_AT24C32";
 const char S_URL_PINMAP[] PROGMEM = "/other/pinmap";
+const char S_URL_API_STATUS[] PROGMEM = "/api/status";
+const char S_URL_API_LOG[] PROGMEM = "/api/log";
+const char S_URL_API_LOG_ALL[] PROGMEM = "/api/log/all";
+
+// Static files are cached by browser. Change version in URLs and ETag, when content or log descriptions
+// are changed. ETag is weak, because it is shared by plain and gzip content. See Static/generate_static_files.py
+const char S_URL_STATIC_STYLE[] PROGMEM = "/static/3/growbox.css";
+const char S_URL_STATIC_SCRIPT[] PROGMEM = "/static/3/growbox.js";
+const char S_URL_STATIC_LOG_DESCRIPTIONS[] PROGMEM = "/static/3/logdescriptions.js";
+const char S_HTTP_STATIC_ETAG[] PROGMEM = "W/\"gb3\"";
+
+// Page of URL, see WebServerClass::findHttpPage()
+enum HttpPage{
+  HTTP_PAGE_NOT_FOUND,
+  HTTP_PAGE_STATUS,
+  HTTP_PAGE_DAILY_LOG,
+  HTTP_PAGE_GENERAL_OPTIONS,
+  HTTP_PAGE_GENERAL_OPTIONS_SUMMARY,
+  HTTP_PAGE_WATERING,             // "/watering" or "/watering/N"
+  HTTP_PAGE_HARDWARE,
+  HTTP_PAGE_OTHER,
+  HTTP_PAGE_DUMP_INTERNAL,
+  HTTP_PAGE_DUMP_AT24C32,
+  HTTP_PAGE_PINMAP,
+  HTTP_PAGE_STATIC_STYLE,
+  HTTP_PAGE_STATIC_SCRIPT,
+  HTTP_PAGE_STATIC_LOG_DESCRIPTIONS,
+  HTTP_PAGE_API_STATUS,
+  HTTP_PAGE_API_LOG,
+  HTTP_PAGE_API_LOG_ALL
+};
+
+// Form field of POST request, see WebServerClass::findPostField()
+enum PostField{
+  POST_FIELD_UNKNOWN,
+  POST_FIELD_IS_WIFI_STATION_MODE,
+  POST_FIELD_WIFI_SSID,
+  POST_FIELD_WIFI_PASS,
+  POST_FIELD_RESET_STORED_LOG,
+  POST_FIELD_IS_STORE_LOG_RECORDS_ENABLED,
+  POST_FIELD_REBOOT_CONTROLLER,
+  POST_FIELD_RESET_FIRMWARE,
+  POST_FIELD_MEASURE_LOG_SCAN,
+  POST_FIELD_TURN_TO_DAY_MODE_AT,
+  POST_FIELD_TURN_TO_NIGHT_MODE_AT,
+  POST_FIELD_TEMP_DAY_MIN,
+  POST_FIELD_TEMP_DAY_MAX,
+  POST_FIELD_TEMP_NIGHT_MIN,
+  POST_FIELD_TEMP_NIGHT_MAX,
+  POST_FIELD_CRIT_TEMP_MIN,
+  POST_FIELD_CRIT_TEMP_MAX,
+  POST_FIELD_IS_WET_SENSOR_CONNECTED,
+  POST_FIELD_IS_WATER_PUMP_CONNECTED,
+  POST_FIELD_USE_WET_SENSOR_FOR_WATERING,
+  POST_FIELD_SKIP_NEXT_WATERING,
+  POST_FIELD_IN_AIR_VALUE,
+  POST_FIELD_VERY_DRY_VALUE,
+  POST_FIELD_DRY_VALUE,
+  POST_FIELD_NORMAL_VALUE,
+  POST_FIELD_WET_VALUE,
+  POST_FIELD_VERY_WET_VALUE,
+  POST_FIELD_DRY_WATERING_DURATION,
+  POST_FIELD_VERY_DRY_WATERING_DURATION,
+  POST_FIELD_START_WATERING_AT,
+  POST_FIELD_RUN_DRY_WATERING_NOW,
+  POST_FIELD_CLEAR_LAST_WATERING_TIME,
+  POST_FIELD_SET_CLOCK_TIME,
+  POST_FIELD_USE_RTC,
+  POST_FIELD_AUTO_ADJUST_TIME_STAMP_DELTA,
+  POST_FIELD_IS_EEPROM_AT24C32_CONNECTED,
+  POST_FIELD_USE_THERMOMETER,
+  POST_FIELD_USE_LIGHT,
+  POST_FIELD_USE_FAN,
+  POST_FIELD_USE_HEATER,
+  POST_FIELD_DAY_COLD_SPEED,
+  POST_FIELD_DAY_NORMAL_SPEED,
+  POST_FIELD_DAY_HOT_SPEED,
+  POST_FIELD_NIGHT_COLD_SPEED,
+  POST_FIELD_NIGHT_NORMAL_SPEED,
+  POST_FIELD_NIGHT_HOT_SPEED,
+  POST_FIELD_DAY_COLD_RATIO,
+  POST_FIELD_DAY_NORMAL_RATIO,
+  POST_FIELD_DAY_HOT_RATIO,
+  POST_FIELD_NIGHT_COLD_RATIO,
+  POST_FIELD_NIGHT_NORMAL_RATIO,
+  POST_FIELD_NIGHT_HOT_RATIO
+};
 
-class WebServerClass{
+// Print interface appends response data to Wi-Fi frame, numbers and time are formatted without String
+class WebServerClass : public Print{
 private:
+  static const byte HTTP_PARAMS_MAX_COUNT = 24;
+  static const byte SERIAL_COMMAND_MAX_SIZE = 128;
+
+  // Binary log batch: [version][flags][count][next cursor, 4 bytes] + count * [time stamp, 4 bytes][data][data1],
+  // numbers are little-endian
+  static const byte LOG_API_FORMAT_VERSION = 1;
+  static const byte LOG_API_BATCH_MAX_SIZE = 32;
+  static const byte LOG_API_HEADER_SIZE = 7;
+  static const byte LOG_API_RECORD_SIZE = 6;
+  static const byte LOG_API_FLAG_CURSOR_LOST = 0x01;  // records after cursor were overwritten, batch starts from oldest one
+  static const byte LOG_API_FLAG_HAS_MORE = 0x02;     // next batch is ready
+
+  // Parameter of current request, points to request buffer decoded in place
+  struct HttpParam{
+    const char* name;
+    const char* value;
+  };
+
   byte c_wifiPortDescriptor;
   byte c_isWifiResponseError;
   byte c_isWifiForceUpdateGrowboxState;
+  boolean c_isKeepAliveAccepted;   // by client of current request
+  boolean c_isKeepAliveResponse;   // response is delimited by length, connection is kept after it
+  byte c_httpParamsCount;
+  HttpParam c_httpParams[HTTP_PARAMS_MAX_COUNT];
 
 public:
   void init();
   void update();
 
+  using Print::write;
+  virtual size_t write(uint8_t c);
+  virtual size_t write(const uint8_t* buffer, size_t size);
+
 public:
   boolean handleSerialWiFiEvent();
   boolean handleSerialMonitorEvent();
@@ -37,30 +152,34 @@ public:
   /////////////////////////////////////////////////////////////////////
 private:
   void httpNotFound();
-  void httpRedirect(const String &url);
+  void httpError(const __FlashStringHelper* status);
+  void httpRedirect(const char* url);
 
+  void httpConnectionHeader(boolean isLengthDelimited);
+  void httpStreamHeaderComplete();
   void httpPageHeader();
   void httpPageComplete();
+  void httpJsonHeader();
+  boolean httpStaticFileHeader(const char* ifNoneMatch, const __FlashStringHelper* contentType, boolean isGzip, word contentLength);
+  void httpStaticFile(const char* ifNoneMatch, boolean isGzipAccepted, const __FlashStringHelper* contentType, const __FlashStringHelper* data, const byte* gzipData, word gzipSize);
 
   /////////////////////////////////////////////////////////////////////
   //                         HTTP PARAMETERS                         //
   /////////////////////////////////////////////////////////////////////
 
-  String encodeHttpString(const String& dirtyValue);
-  boolean getHttpParamByIndex(const String& params, const word index, String& name, String& value);
-  boolean searchHttpParamByName(const String& params, const __FlashStringHelper* targetName, String& targetValue);
+  void decodeHttpString(char* value);
+  void parseHttpParams(char* params);
+  const char* getHttpParam(const __FlashStringHelper* name);
 
   /////////////////////////////////////////////////////////////////////
   //                               HTML                              //
   /////////////////////////////////////////////////////////////////////
 
   void rawData(const __FlashStringHelper* data);
-  void rawData(const String &data);
   void rawData(float data);
   void rawData(time_t data, boolean interpretateAsULong = false, boolean forceShowZeroTimeStamp = false);
   template <class T> void rawData(T data) {
-    String str(data);
-    rawData(str);
+    print(data);
   }
 
   void tagButton(const __FlashStringHelper* url, const __FlashStringHelper* text, boolean isSelected);
@@ -68,16 +187,17 @@ private:
   void tagRadioButton(const __FlashStringHelper* name, const __FlashStringHelper* text, const __FlashStringHelper* value, boolean isSelected);
   void tagInputNumber(const __FlashStringHelper* name, const __FlashStringHelper* text, long minValue, long maxValue, long value);
   void tagInputTime(const __FlashStringHelper* name, const __FlashStringHelper* text, word value, const __FlashStringHelper* onChange = NULL);
-  word getTimeFromInput(const String& value);
+  word getTimeFromInput(const char* value);
 
-  void tagOption(const String& value, const String& text, boolean isSelected, boolean isDisabled = false);
   void tagOption(const __FlashStringHelper* value, const __FlashStringHelper* text, boolean isSelected, boolean isDisabled = false);
-
-  void appendOptionToSelectDynamic(const __FlashStringHelper* selectId, const String& value, const String& text, boolean isSelected);
-  void appendOptionToSelectDynamic(const __FlashStringHelper* selectId, const __FlashStringHelper* value, const String& text, boolean isSelected);
-  void appendOptionToSelectDynamic(const __FlashStringHelper* selectId, const __FlashStringHelper* value, const __FlashStringHelper* text, boolean isSelected);
-
-  void growboxClockJavaScript(const __FlashStringHelper* growboxTimeStampId = NULL, const __FlashStringHelper* browserTimeStampId = NULL, const __FlashStringHelper* diffTimeStampId = NULL, const __FlashStringHelper* setClockTimeHiddenInputId = NULL);
+  // Option with not constant value or text: tagOptionBegin(), value, tagOptionText(), text, tagOptionEnd()
+  void tagOptionBegin(boolean isSelected, boolean isDisabled = false);
+  void tagOptionBegin(word value, byte base, boolean isSelected); // number value, up to tagOptionText()
+  void tagOptionText();
+  void tagOptionEnd();
+
+  void scriptArgument(const __FlashStringHelper* value);
+  void growboxClockJavaScript(const __FlashStringHelper* growboxTimeStampId = NULL, const __FlashStringHelper* browserTimeStampId = NULL, const __FlashStringHelper* diffTimeStampId = NULL);
   void spanTag_RedIfTrue(const __FlashStringHelper* text, boolean isRed);
   void printTemperatue(float t);
   void printTemperatueRange(float t1, float t2);
@@ -87,7 +207,8 @@ private:
   //                      COMMON FOR ALL PAGES                       //
   /////////////////////////////////////////////////////////////////////
 
-  void httpProcessGet(const String &input, const String &getParams);
+  byte findHttpPage(const char* url, byte& wsIndex);
+  void httpProcessGet(const char* url, char* getParams, const char* ifNoneMatch, boolean isGzipAccepted);
 
   /////////////////////////////////////////////////////////////////////
   //                          STATUS PAGE                            //
@@ -96,12 +217,32 @@ private:
   word getWordTimePeriodinDay(word start, word stop);
   void sendStatusPage();
 
+  /////////////////////////////////////////////////////////////////////
+  //                         STATUS JSON API                         //
+  /////////////////////////////////////////////////////////////////////
+
+  void jsonField(const __FlashStringHelper* name, boolean isFirst = false);
+  void jsonBoolean(boolean value);
+  void jsonTemperature(float t);
+  void jsonTimeStamp(time_t time);
+  void jsonRelay(boolean isUsed, boolean isTurnedOn);
+  void sendStatusJson();
+
+  /////////////////////////////////////////////////////////////////////
+  //                             LOG API                             //
+  /////////////////////////////////////////////////////////////////////
+
+  void rawLittleEndian(unsigned long value, byte size);
+  void rawLogRecord(const LogRecord& logRecord);
+  void sendLogApi();
+  void sendLogRecordsStream();
+
   /////////////////////////////////////////////////////////////////////
   //                            LOG PAGE                             //
   /////////////////////////////////////////////////////////////////////
 
-  boolean isSameDay(tmElements_t time1, tmElements_t time2);
-  void sendLogPage(const String& getParams);
+  void sendLogDescriptionsScript(const char* ifNoneMatch);
+  void sendLogPage();
 
   /////////////////////////////////////////////////////////////////////
   //                          GENERAL PAGE                           //
@@ -109,7 +250,7 @@ private:
 
   void updateDayNightPeriodJavaScript();
   void sendGeneralOptionsPage_FanParameterRow(const __FlashStringHelper* mode, const __FlashStringHelper* temperature, const __FlashStringHelper* controlNamePrefix, byte fanSpeedValue);
-  void sendGeneralOptionsPage(const String& getParams);
+  void sendGeneralOptionsPage();
 
   void sendGeneralOptionsSummaryPage_ModeRow(const __FlashStringHelper* description, word startTime = 0xFFFF, word stopTime = 0xFFFF);
   void sendGeneralOptionsSummaryPage_DataRow(
@@ -122,16 +263,19 @@ private:
   //                         WATERING PAGE                           //
   /////////////////////////////////////////////////////////////////////
 
-  byte getWateringIndexFromUrl(const String& url);
-  void sendWateringOptionsPage(const String& url, byte wsIndex);
+  byte getWateringIndexFromUrl(const char* url);
+  void printWateringUrl(byte wsIndex);
+  void sendWateringOptionsPage(const char* url, byte wsIndex);
 
   /////////////////////////////////////////////////////////////////////
   //                        HARDWARE PAGES                           //
   /////////////////////////////////////////////////////////////////////
 
-  void sendHardwareOptionsPage(const String& getParams);
-  void sendStorageDumpPage(const String& getParams, boolean isInternal);
-  void sendOtherOptionsPage(const String& getParams);
+  void sendHardwareOptionsPage();
+  void sendStorageDumpPage(boolean isInternal);
+  void sendOtherOptionsPage_StorageStatisticsRow(const __FlashStringHelper* description, unsigned long value, const __FlashStringHelper* units);
+  void sendOtherOptionsPage_StorageStatistics();
+  void sendOtherOptionsPage();
   void sendPinMapPage_TableRow(byte pin, const __FlashStringHelper* description, byte wsIndex = 0xFF);
   void sendPinMapPage();
 
@@ -139,8 +283,9 @@ private:
   //                          POST HANDLING                          //
   /////////////////////////////////////////////////////////////////////
 
-  String applyPostParams(const String& url, const String& postParams);
-  boolean applyPostParam(const String& url, const String& name, const String& value);
+  byte findPostField(const char* name);
+  const char* applyPostParams(const char* url, char* postParams);
+  boolean applyPostParam(const char* url, const char* name, const char* value);
 
   /////////////////////////////////////////////////////////////////////
   //                              OTHER                              //
@@ -4,6 +4,7 @@
 #include "StorageHelper.h"
 #include "Controller.h"
 #include "StringUtils.h"
+#include "PrintUtils.h"
 
 void WebServerClass::init() {
   RAK410_XBeeWifi.init();
@@ -15,23 +16,37 @@ void WebServerClass::update() {
 
 boolean WebServerClass::handleSerialWiFiEvent() {
 
-  String url, getParams, postParams;
+  char *url, *getParams, *postParams, *ifNoneMatch; // views of request buffer
+  boolean isGzipAccepted;
 
   // HTTP response supplemental   
-  RAK410_XBeeWifiClass::RequestType commandType = RAK410_XBeeWifi.handleSerialEvent(c_wifiPortDescriptor, url, getParams, postParams);
+  RAK410_XBeeWifiClass::RequestType commandType = RAK410_XBeeWifi.handleSerialEvent(c_wifiPortDescriptor, url, getParams, postParams, ifNoneMatch, isGzipAccepted, c_isKeepAliveAccepted);
 
   c_isWifiResponseError = false;
   c_isWifiForceUpdateGrowboxState = false;
+  c_isKeepAliveResponse = false;
 
   switch (commandType) {
     case RAK410_XBeeWifiClass::RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_GET:
-      httpProcessGet(url, getParams);
+      httpProcessGet(url, getParams, ifNoneMatch, isGzipAccepted);
       break;
 
     case RAK410_XBeeWifiClass::RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_POST:
       httpRedirect(applyPostParams(url, postParams));
       break;
 
+    case RAK410_XBeeWifiClass::RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_BAD_REQUEST:
+      httpError(F("400 Bad Request"));
+      break;
+
+    case RAK410_XBeeWifiClass::RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_TOO_LARGE:
+      httpError(F("413 Payload Too Large"));
+      break;
+
+    case RAK410_XBeeWifiClass::RAK410_XBEEWIFI_REQUEST_TYPE_DATA_HTTP_BUSY:
+      httpError(F("503 Service Unavailable"));
+      break;
+
     default:
       break;
   }
@@ -62,8 +77,19 @@ boolean WebServerClass::handleSerialMonitorEvent() {
     return false;
   }
 
-  String url(input.substring(0, indexOfQestionChar));
-  String postParams(input.substring(indexOfQestionChar + 1));
+  if (input.length() >= SERIAL_COMMAND_MAX_SIZE) {
+    if (g_useSerialMonitor) {
+      Serial.print(F("Serial command is too long, max size is "));
+      Serial.println(SERIAL_COMMAND_MAX_SIZE - 1);
+    }
+    return false;
+  }
+
+  char buffer[SERIAL_COMMAND_MAX_SIZE];
+  input.toCharArray(buffer, sizeof(buffer));
+  buffer[indexOfQestionChar] = 0x00;
+  const char* url = buffer;
+  char* postParams = buffer + indexOfQestionChar + 1;
 
   if (g_useSerialMonitor) {
     Serial.print(F("Receive from [SM] POST ["));
@@ -83,18 +109,32 @@ boolean WebServerClass::handleSerialMonitorEvent() {
 /////////////////////////////////////////////////////////////////////
 
 void WebServerClass::httpNotFound() {
-  RAK410_XBeeWifi.sendFixedSizeData(c_wifiPortDescriptor, F("HTTP/1.1 404 Not Found\r\nConnection: close\r\n\r\n"));
-  RAK410_XBeeWifi.sendCloseConnection(c_wifiPortDescriptor);
+  RAK410_XBeeWifi.sendAutoSizeFrameStart(c_wifiPortDescriptor);
+  rawData(F("HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n"));
+  httpConnectionHeader(true);
+  rawData(FS(S_CRLF));
+  httpPageComplete();
+}
+
+// Request was not read completely, so connection is closed
+void WebServerClass::httpError(const __FlashStringHelper* status) {
+  RAK410_XBeeWifi.sendAutoSizeFrameStart(c_wifiPortDescriptor);
+  rawData(F("HTTP/1.1 "));
+  rawData(status);
+  rawData(F("\r\nContent-Length: 0\r\n"));
+  httpConnectionHeader(false);
+  rawData(FS(S_CRLF));
+  httpPageComplete();
 }
 
 // WARNING! RAK 410 became mad when 2 parallel connections comes. Like with Chrome and POST request, when RAK response 303.
 // Connection for POST request closed by Chrome (not by RAK). And during this time Chrome creates new parallel connection for GET
 // request.
-void WebServerClass::httpRedirect(const String &url) {
+void WebServerClass::httpRedirect(const char* url) {
   //const __FlashStringHelper* header = F("HTTP/1.1 303 See Other\r\nLocation: "); // DO not use it with RAK 410
   const __FlashStringHelper* header = F("HTTP/1.1 200 OK\r\nConnection: close\r\nrefresh: 1; url=");
 
-  RAK410_XBeeWifi.sendFixedSizeFrameStart(c_wifiPortDescriptor, StringUtils::flashStringLength(header) + url.length() + StringUtils::flashStringLength(FS(S_CRLFCRLF)));
+  RAK410_XBeeWifi.sendFixedSizeFrameStart(c_wifiPortDescriptor, StringUtils::flashStringLength(header) + strlen(url) + StringUtils::flashStringLength(FS(S_CRLFCRLF)));
   RAK410_XBeeWifi.sendFixedSizeFrameData(header);
   RAK410_XBeeWifi.sendFixedSizeFrameData(url);
   RAK410_XBeeWifi.sendFixedSizeFrameData(FS(S_CRLFCRLF));
@@ -103,90 +143,177 @@ void WebServerClass::httpRedirect(const String &url) {
   RAK410_XBeeWifi.sendCloseConnection(c_wifiPortDescriptor);
 }
 
+// Connection is kept, if client accepts it and response has Content-Length or no body.
+// Other responses are delimited by connection close
+void WebServerClass::httpConnectionHeader(boolean isLengthDelimited) {
+  c_isKeepAliveResponse = (c_isKeepAliveAccepted && isLengthDelimited);
+  rawData(c_isKeepAliveResponse ? F("Connection: keep-alive\r\n") : F("Connection: close\r\n"));
+}
+
+// Content of unknown length is sent chunked, one chunk per Wi-Fi frame. Client, that closes connection
+// after response (HTTP/1.0 too), gets content delimited by connection close
+void WebServerClass::httpStreamHeaderComplete() {
+  boolean isChunked = (RAK410_XBeeWifiClass::WIFI_IS_CHUNKED_TRANSFER_SUPPORTED && c_isKeepAliveAccepted);
+  httpConnectionHeader(isChunked);
+  if (isChunked) {
+    rawData(F("Transfer-Encoding: chunked\r\n"));
+  }
+  rawData(FS(S_CRLF));
+  if (isChunked) {
+    RAK410_XBeeWifi.sendAutoSizeFrameChunksStart();
+  }
+}
+
 void WebServerClass::httpPageHeader() {
-  RAK410_XBeeWifi.sendFixedSizeData(c_wifiPortDescriptor, F("HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Type: text/html\r\n\r\n"));
   RAK410_XBeeWifi.sendAutoSizeFrameStart(c_wifiPortDescriptor);
+  rawData(F("HTTP/1.1 200 OK\r\nContent-Type: text/html\r\n"));
+  httpStreamHeaderComplete();
+}
+
+void WebServerClass::httpJsonHeader() {
+  RAK410_XBeeWifi.sendAutoSizeFrameStart(c_wifiPortDescriptor);
+  rawData(F("HTTP/1.1 200 OK\r\nCache-Control: no-cache\r\nContent-Type: application/json\r\n"));
+  httpStreamHeaderComplete();
 }
 
 void WebServerClass::httpPageComplete() {
-  RAK410_XBeeWifi.sendAutoSizeFrameStop(c_wifiPortDescriptor);
-  RAK410_XBeeWifi.sendCloseConnection(c_wifiPortDescriptor);
+  if (!RAK410_XBeeWifi.sendAutoSizeFrameStop(c_wifiPortDescriptor, true)) {
+    c_isWifiResponseError = true; // client waits for rest of content
+  }
+  if (c_isKeepAliveResponse && !c_isWifiResponseError) {
+    if (!RAK410_XBeeWifi.keepConnection(c_wifiPortDescriptor)) {
+      c_isWifiResponseError = true; // last frame failed, connection is closed
+    }
+  }
+  else {
+    RAK410_XBeeWifi.sendCloseConnection(c_wifiPortDescriptor);
+  }
+}
+
+// Versioned static file, browser revalidates it by ETag only after max-age is expired.
+// Returns false, if browser has actual file and response is completed. Zero length is unknown one,
+// content is streamed then
+boolean WebServerClass::httpStaticFileHeader(const char* ifNoneMatch, const __FlashStringHelper* contentType, boolean isGzip, word contentLength) {
+  boolean isNotModified = (ifNoneMatch != NULL && StringUtils::flashStringEquals(ifNoneMatch, FS(S_HTTP_STATIC_ETAG)));
+
+  RAK410_XBeeWifi.sendAutoSizeFrameStart(c_wifiPortDescriptor);
+  rawData(isNotModified ? F("HTTP/1.1 304 Not Modified\r\n") : F("HTTP/1.1 200 OK\r\n"));
+  rawData(F("Cache-Control: max-age=31536000\r\nVary: Accept-Encoding\r\nETag: "));
+  rawData(FS(S_HTTP_STATIC_ETAG));
+  rawData(FS(S_CRLF));
+  if (isNotModified) {
+    httpConnectionHeader(true);
+    rawData(FS(S_CRLF));
+    httpPageComplete();
+    return false;
+  }
+
+  rawData(F("Content-Type: "));
+  rawData(contentType);
+  rawData(FS(S_CRLF));
+  if (isGzip) {
+    rawData(F("Content-Encoding: gzip\r\n"));
+  }
+  if (contentLength == 0) {
+    httpStreamHeaderComplete();
+    return true;
+  }
+  rawData(F("Content-Length: "));
+  rawData(contentLength);
+  rawData(FS(S_CRLF));
+  httpConnectionHeader(true);
+  rawData(FS(S_CRLF));
+  return true;
+}
+
+// Gzip content is sent as is, if browser accepts it
+void WebServerClass::httpStaticFile(const char* ifNoneMatch, boolean isGzipAccepted, const __FlashStringHelper* contentType, const __FlashStringHelper* data, const byte* gzipData, word gzipSize) {
+  if (!httpStaticFileHeader(ifNoneMatch, contentType, isGzipAccepted, isGzipAccepted ? gzipSize : StringUtils::flashStringLength(data))) {
+    return;
+  }
+  if (!isGzipAccepted) {
+    rawData(data);
+  }
+  else if (!RAK410_XBeeWifi.sendAutoSizeFrameData(c_wifiPortDescriptor, (const char*) gzipData, gzipSize, true)) {
+    c_isWifiResponseError = true;
+  }
+  httpPageComplete();
 }
 
 /////////////////////////////////////////////////////////////////////
 //                         HTTP PARAMETERS                         //
 /////////////////////////////////////////////////////////////////////
 
-String WebServerClass::encodeHttpString(const String& dirtyValue) {
-
-  String value;
-  for (unsigned int i = 0; i < dirtyValue.length(); i++) {
-    if (dirtyValue[i] == '+') {
-      value += ' ';
+// Decoded value is not longer than encoded one
+void WebServerClass::decodeHttpString(char* value) {
+  char* out = value;
+  for (const char* in = value; *in != 0x00; in++) {
+    if (*in == '+') {
+      *out++ = ' ';
     }
-    else if (dirtyValue[i] == '%') {
-      if (i + 2 < dirtyValue.length()) {
-        byte hiCharPart = StringUtils::hexCharToByte(dirtyValue[i + 1]);
-        byte loCharPart = StringUtils::hexCharToByte(dirtyValue[i + 2]);
-        if (hiCharPart != 0xFF && loCharPart != 0xFF) {
-          value += (char)((hiCharPart << 4) + loCharPart);
-        }
+    else if (*in == '%') {
+      if (in[1] == 0x00 || in[2] == 0x00) {
+        break;
+      }
+      byte hiCharPart = StringUtils::hexCharToByte(in[1]);
+      byte loCharPart = StringUtils::hexCharToByte(in[2]);
+      if (hiCharPart != 0xFF && loCharPart != 0xFF) {
+        *out++ = (char)((hiCharPart << 4) + loCharPart);
       }
-      i += 2;
+      in += 2;
     }
     else {
-      value += dirtyValue[i];
+      *out++ = *in;
     }
   }
-  return value;
+  *out = 0x00;
 }
 
-boolean WebServerClass::getHttpParamByIndex(const String& params, const word index, String& name, String& value) {
-
-  word paramsCount = 0;
-
-  int beginIndex = 0;
-  int endIndex = params.indexOf('&');
-  while (beginIndex < (int)params.length()) {
-    if (endIndex == -1) {
-      endIndex = params.length();
+// Params are split and decoded in one pass, table points to params buffer
+void WebServerClass::parseHttpParams(char* params) {
+  c_httpParamsCount = 0;
+  while (*params != 0x00) {
+    char* end = strchr(params, '&');
+    if (end != NULL) {
+      *end = 0x00;
     }
 
-    if (paramsCount == index) {
-      String param = params.substring(beginIndex, endIndex);
-
-      int equalsCharIndex = param.indexOf('=');
-      if (equalsCharIndex == -1) {
-        name = encodeHttpString(param);
-        value = String();
+    if (c_httpParamsCount < HTTP_PARAMS_MAX_COUNT) {
+      HttpParam& param = c_httpParams[c_httpParamsCount++];
+      char* equalsChar = strchr(params, '=');
+      char* value;
+      if (equalsChar == NULL) {
+        value = params + strlen(params); // empty string
       }
       else {
-        name = encodeHttpString(param.substring(0, equalsCharIndex));
-        value = encodeHttpString(param.substring(equalsCharIndex + 1));
+        *equalsChar = 0x00;
+        value = equalsChar + 1;
       }
-      return true;
+      decodeHttpString(params);
+      decodeHttpString(value);
+      param.name = params;
+      param.value = value;
+    }
+    else {
+      showWebMessage(F("Too many parameters, rest skipped"));
+      break;
     }
 
-    paramsCount++;
-
-    beginIndex = endIndex + 1;
-    endIndex = params.indexOf('&', beginIndex);
+    if (end == NULL) {
+      break;
+    }
+    params = end + 1;
   }
-
-  return false;
 }
 
-boolean WebServerClass::searchHttpParamByName(const String& params, const __FlashStringHelper* targetName, String& targetValue) {
-  String name, value;
-  word index = 0;
-  while(getHttpParamByIndex(params, index, name, value)) {
-    if (StringUtils::flashStringEquals(name, targetName)) {
-      targetValue = value;
-      return true;
+// Returns NULL, if parameter is not found
+const char* WebServerClass::getHttpParam(const __FlashStringHelper* name) {
+  for (byte i = 0; i < c_httpParamsCount; i++) {
+    if (StringUtils::flashStringEquals(c_httpParams[i].name, name)) {
+      return c_httpParams[i].value;
     }
-    index++;
   }
-  return false;
+  return NULL;
 }
 
 /////////////////////////////////////////////////////////////////////
@@ -199,33 +326,36 @@ void WebServerClass::rawData(const __FlashStringHelper* data) {
   }
 }
 
-void WebServerClass::rawData(const String &data) {
-  if (!RAK410_XBeeWifi.sendAutoSizeFrameData(c_wifiPortDescriptor, data)) {
-    c_isWifiResponseError = true;
-  }
-}
-
 void WebServerClass::rawData(float data) {
-  String str = StringUtils::floatToString(data);
-  rawData(str);
+  PrintUtils::printFloat(*this, data);
 }
 
 void WebServerClass::rawData(time_t data, boolean interpretateAsULong, boolean forceShowZeroTimeStamp) {
   if (interpretateAsULong == true) {
-    String str(data);
-    rawData(str);
+    print(data);
   }
   else {
     if (data == 0 && !forceShowZeroTimeStamp) {
       rawData(F("N/A"));
     }
     else {
-      String str = StringUtils::timeStampToString(data);
-      rawData(str);
+      PrintUtils::printTimeStamp(*this, data);
     }
   }
 }
 
+size_t WebServerClass::write(uint8_t c) {
+  return write(&c, 1);
+}
+
+size_t WebServerClass::write(const uint8_t* buffer, size_t size) {
+  if (!RAK410_XBeeWifi.sendAutoSizeFrameData(c_wifiPortDescriptor, (const char*) buffer, size, false)) {
+    c_isWifiResponseError = true;
+    return 0;
+  }
+  return size;
+}
+
 void WebServerClass::tagButton(const __FlashStringHelper* url, const __FlashStringHelper* text, boolean isSelected) {
   rawData(F("<input type='button' onclick='document.location=\""));
   rawData(url);
@@ -304,7 +434,7 @@ void WebServerClass::tagInputTime(const __FlashStringHelper* name, const __Flash
   rawData(F("' id='"));
   rawData(name);
   rawData(F("' value='"));
-  rawData(StringUtils::wordTimeToString(value));
+  PrintUtils::printWordTime(*this, value);
   if (onChange != NULL){
     rawData(F("' onchange='"));
     rawData(onChange);
@@ -315,8 +445,8 @@ void WebServerClass::tagInputTime(const __FlashStringHelper* name, const __Flash
   }
 }
 
-word WebServerClass::getTimeFromInput(const String& value) {
-  if (value.length() != 5) {
+word WebServerClass::getTimeFromInput(const char* value) {
+  if (strlen(value) != 5) {
     return 0xFFFF;
   }
 
@@ -329,157 +459,75 @@ word WebServerClass::getTimeFromInput(const String& value) {
   return valueHour * 60 + valueMinute;
 }
 
-void WebServerClass::tagOption(const String& value, const String& text, boolean isSelected, boolean isDisabled) {
-  rawData(F("<option"));
-  if (value.length() != 0) {
-    rawData(F(" value='"));
+void WebServerClass::tagOption(const __FlashStringHelper* value, const __FlashStringHelper* text, boolean isSelected, boolean isDisabled) {
+  if (pgm_read_byte(value) == '\0') {
+    // Option without value attribute
+    rawData(F("<option"));
+    if (isDisabled) {
+      rawData(F(" disabled='disabled'"));
+    }
+    if (isSelected) {
+      rawData(F(" selected='selected'"));
+    }
+    rawData('>');
+  }
+  else {
+    tagOptionBegin(isSelected, isDisabled);
     rawData(value);
-    rawData('\'');
+    tagOptionText();
   }
+  rawData(text);
+  tagOptionEnd();
+}
+
+void WebServerClass::tagOptionBegin(boolean isSelected, boolean isDisabled) {
+  rawData(F("<option"));
   if (isDisabled) {
     rawData(F(" disabled='disabled'"));
   }
   if (isSelected) {
     rawData(F(" selected='selected'"));
   }
-  rawData('>');
-  rawData(text);
-  rawData(F("</option>"));
-}
-void WebServerClass::tagOption(const __FlashStringHelper* value, const __FlashStringHelper* text, boolean isSelected, boolean isDisabled) {
-  tagOption(StringUtils::flashStringLoad(value), StringUtils::flashStringLoad(text), isSelected, isDisabled);
+  rawData(F(" value='"));
 }
 
-void WebServerClass::appendOptionToSelectDynamic(const __FlashStringHelper* selectId, const String& value, const String& text, boolean isSelected) {
-  rawData(F("<script type='text/javascript'>"));
-  rawData(F("var opt = document.createElement('option');"));
-  if (value.length() != 0) {
-    rawData(F("opt.value = '"));
-    rawData(value);
-    rawData(F("';"));
-  }
-  rawData(F("opt.text = '"));    //opt.value = i;
-  rawData(text);
-  rawData(F("';"));
-  if (isSelected) {
-    rawData(F("opt.selected = true;"));
-    rawData(F("opt.style.fontWeight = 'bold';"));
-  }
-  rawData(F("document.getElementById('"));
-  rawData(selectId);
-  rawData(F("').appendChild(opt);"));
-  rawData(F("</script>"));
+void WebServerClass::tagOptionBegin(word value, byte base, boolean isSelected) {
+  tagOptionBegin(isSelected);
+  print(value, base);
 }
 
-void WebServerClass::appendOptionToSelectDynamic(const __FlashStringHelper* selectId, const __FlashStringHelper* value, const String& text, boolean isSelected) {
-  appendOptionToSelectDynamic(selectId, StringUtils::flashStringLoad(value), text, isSelected);
+void WebServerClass::tagOptionText() {
+  rawData(F("'>"));
 }
 
-void WebServerClass::appendOptionToSelectDynamic(const __FlashStringHelper* selectId, const __FlashStringHelper* value, const __FlashStringHelper* text, boolean isSelected) {
-  appendOptionToSelectDynamic(selectId, StringUtils::flashStringLoad(value), StringUtils::flashStringLoad(text), isSelected);
+void WebServerClass::tagOptionEnd() {
+  rawData(F("</option>"));
 }
 
-void WebServerClass::growboxClockJavaScript(const __FlashStringHelper* growboxTimeStampId, const __FlashStringHelper* browserTimeStampId, const __FlashStringHelper* diffTimeStampId, const __FlashStringHelper* setClockTimeHiddenInputId) {
-
-  rawData(F("<script type='text/javascript'>"));
-  rawData(F("var g_timeFormat={year:'numeric',month:'2-digit',day:'2-digit',hour:'2-digit',minute:'2-digit',second:'2-digit'};"));
-  rawData(F("var g_gbts=new Date((")); //growbox timestamp
-  rawData(now() + WEB_SERVER_AVERAGE_PAGE_LOAD_TIME_SEC, true);
-  rawData(F("+new Date().getTimezoneOffset()*60)*1000"));
-  rawData(F(");"));
-
-  rawData(F("var g_TSDiff=new Date().getTime()-g_gbts;"));
-  if (diffTimeStampId != NULL) {
-    rawData(F("var diffStr='';"));
-    rawData(F("var absTSDiffSec=Math.abs(Math.floor(g_TSDiff/1000));"));
-    rawData(F("if (absTSDiffSec>0){"));
-    {
-      rawData(F("var diffSeconds=absTSDiffSec%60;"));
-      rawData(F("var diffMinutes=Math.floor(absTSDiffSec/60)%60;"));
-      rawData(F("var diffHours=Math.floor(absTSDiffSec/60/60);"));
-      rawData(F("if(diffHours>365*24){"));
-      {
-        rawData(F("diffStr='over year';"));
-      }
-      rawData(F("}else if (diffHours>30*24){"));
-      {
-        rawData(F("diffStr='over month';"));
-      }
-      rawData(F("}else if (diffHours>7*24){"));
-      {
-        rawData(F("diffStr='over week';"));
-      }
-      rawData(F("}else if (diffHours>24){"));
-      {
-        rawData(F("diffStr='over day';"));
-      }
-      rawData(F("}else if (diffHours>0){"));
-      {
-        rawData(F("diffStr=diffHours+' h '+diffMinutes+' m '+diffSeconds+' s';"));
-      }
-      rawData(F("}else if (diffMinutes > 0){"));
-      {
-        rawData(F("diffStr=diffMinutes+' min '+diffSeconds+' sec';"));
-      }
-      rawData(F("}else if (diffSeconds > 0){"));
-      {
-        rawData(F("diffStr=diffSeconds+' sec';"));
-      }
-      rawData(F("}"));
-      rawData(F("diffStr='Out of sync '+diffStr+' with browser time';"));
-    }
-    rawData(F("}else{"));
-    {
-      rawData(F("diffStr='Synced with browser time';"));
-    }
-    rawData(F("}"));
-    rawData(F("var g_diffTimeStamp=document.getElementById('"));
-    rawData(diffTimeStampId);
-    rawData(F("');"));
-    if (GB_StorageHelper.isAutoCalculatedClockTimeUsed()) {
-      rawData(F("diffStr='Auto calculated. '+diffStr;"));
-      rawData(F("g_diffTimeStamp.style.color='red';"));
-    }
-    else {
-      rawData(F("if (absTSDiffSec>60){g_diffTimeStamp.style.color='red';}"));
-    }
-    rawData(F("g_diffTimeStamp.innerHTML=diffStr;"));
-  }
-
-  rawData(F("function g_uts(){"));{ // update time stamps
-    rawData(F("var bts=new Date();")); // browser time stamp
-    rawData(F("g_gbts.setTime(bts.getTime()-g_TSDiff);"));
-    if (growboxTimeStampId != NULL) {
-      rawData(F("document.getElementById('"));
-      rawData(growboxTimeStampId);
-      rawData(F("').innerHTML=g_gbts.toLocaleString('uk',g_timeFormat);"));
-    }
-    if (browserTimeStampId != NULL) {
-      rawData(F("document.getElementById('"));
-      rawData(browserTimeStampId);
-      rawData(F("').innerHTML=bts.toLocaleString('uk',g_timeFormat);"));
-    }
-    rawData(F("setTimeout(function () {g_uts(); }, 1000);"));
-  }
-  rawData(F("};"));
-
-  rawData(F("g_uts();"));
-
-  if (setClockTimeHiddenInputId != NULL){
-    rawData(F("var g_checkBeforeSetClockTime=function(){"));{
-      rawData(F("if(!confirm(\"Syncronize Growbox time with browser time?\")) {"));{
-        rawData(F("return false;"));
-      }
-      rawData(F("}"));
-      rawData(F("document.getElementById(\""));
-      rawData(setClockTimeHiddenInputId);
-      rawData(F("\").value=Math.floor(new Date().getTime()/1000-new Date().getTimezoneOffset()*60);"));
-      rawData(F("return true;"));
-    }
-    rawData(F("}"));
+// Function arguments are JavaScript strings or null
+void WebServerClass::scriptArgument(const __FlashStringHelper* value) {
+  if (value == NULL) {
+    rawData(F("null"));
+    return;
   }
+  rawData('\'');
+  rawData(value);
+  rawData('\'');
+}
 
-  rawData(F("</script>"));
+// See g_startClock() in S_STATIC_SCRIPT
+void WebServerClass::growboxClockJavaScript(const __FlashStringHelper* growboxTimeStampId, const __FlashStringHelper* browserTimeStampId, const __FlashStringHelper* diffTimeStampId) {
+  rawData(F("<script type='text/javascript'>g_startClock("));
+  rawData(now() + WEB_SERVER_AVERAGE_PAGE_LOAD_TIME_SEC, true);
+  rawData(',');
+  scriptArgument(growboxTimeStampId);
+  rawData(',');
+  scriptArgument(browserTimeStampId);
+  rawData(',');
+  scriptArgument(diffTimeStampId);
+  rawData(',');
+  rawData(GB_StorageHelper.isAutoCalculatedClockTimeUsed() ? F("true") : F("false"));
+  rawData(F(");</script>"));
 }
 
 void WebServerClass::spanTag_RedIfTrue(const __FlashStringHelper* text, boolean isRed) {
@@ -493,25 +541,9 @@ void WebServerClass::spanTag_RedIfTrue(const __FlashStringHelper* text, boolean
   rawData(F("</span>"));
 }
 
+// See g_updDayNightPeriod() in S_STATIC_SCRIPT
 void WebServerClass::updateDayNightPeriodJavaScript() {
-  rawData(F("<script type='text/javascript'>"));
-  rawData(F("function g_wordTimeToString(time){"));{
-    rawData(F("var hour=Math.floor(time/60);"));
-    rawData(F("var minute=time%60;"));
-    rawData(F("return (hour<10?'0':'')+hour+':'+(minute<10?'0':'')+minute;"));
-  }
-  rawData(F("}"));
-  rawData(F("function g_updDayNightPeriod(){"));
-  {
-    rawData(F("var upTime=new Date('01.01.2000 '+document.getElementById('turnToDayModeAt').value+':00');"));
-    rawData(F("var downTime=new Date('01.01.2000 '+document.getElementById('turnToNightModeAt').value+':00');"));
-    rawData(F("var delta=Math.floor((downTime-upTime)/1000/60);")); // in minutes
-    rawData(F("var dayPeriod=(delta>0?delta:24*60+delta);"));
-    rawData(F("document.getElementById(\"dayNightPeriod\").innerHTML=g_wordTimeToString(dayPeriod)+'/'+g_wordTimeToString(24*60-dayPeriod);"));
-  }
-  rawData(F("}"));
-  rawData(F("g_updDayNightPeriod();"));
-  rawData(F("</script>"));
+  rawData(F("<script type='text/javascript'>g_updDayNightPeriod();</script>"));
 }
 
 // Returns 24:00 if dates equal
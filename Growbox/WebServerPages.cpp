@@ -6,35 +6,125 @@
 #include "Thermometer.h" 
 #include "Watering.h"
 #include "RAK410_XBeeWifi.h" 
+#include "PrintUtils.h"
 #include "EEPROM_AT24C32.h" 
+#include "StaticFiles.h"
+
+// Item of PROGMEM tables, which are sorted by name for binary search
+struct ProgMemRoute{
+  const char* name;
+  byte id;
+};
+
+static byte findProgMemRoute(const ProgMemRoute table[], byte tableSize, const char* name, byte notFoundId) {
+  int low = 0;
+  int high = tableSize - 1;
+  while (low <= high) {
+    int middle = (low + high) / 2;
+    int compare = strcmp_P(name, (const char*) pgm_read_word(&table[middle].name));
+    if (compare == 0) {
+      return pgm_read_byte(&table[middle].id);
+    }
+    if (compare < 0) {
+      high = middle - 1;
+    }
+    else {
+      low = middle + 1;
+    }
+  }
+  return notFoundId;
+}
 
 /////////////////////////////////////////////////////////////////////
 //                        COMMON FOR ALL PAGES                     //
 /////////////////////////////////////////////////////////////////////
 
-void WebServerClass::httpProcessGet(const String& url, const String& getParams) {
-
-  byte wsIndex = getWateringIndexFromUrl(url); // FF ig not watering system
-
-  boolean isStatusPage = StringUtils::flashStringEquals(url, FS(S_URL_STATUS));
-  boolean isLogPage = StringUtils::flashStringEquals(url, FS(S_URL_DAILY_LOG));
-
-  boolean isGeneralOptionsPage = StringUtils::flashStringEquals(url, FS(S_URL_GENERAL_OPTIONS));
-  boolean isGeneralOptionsSummaryPage = StringUtils::flashStringEquals(url, FS(S_URL_GENERAL_OPTIONS_SUMMARY));
-  boolean isWateringPage = (wsIndex != 0xFF);
-  boolean isHardwarePage = StringUtils::flashStringEquals(url, FS(S_URL_HARDWARE));
-  boolean isOtherPage = StringUtils::flashStringEquals(url, FS(S_URL_OTHER_PAGE));
-  boolean isDumpInternal = StringUtils::flashStringEquals(url, FS(S_URL_DUMP_INTERNAL));
-  boolean isDumpAT24C32 = StringUtils::flashStringEquals(url, FS(S_URL_DUMP_AT24C32));
-  boolean isPinMapPage = StringUtils::flashStringEquals(url, FS(S_URL_PINMAP));
+const ProgMemRoute HTTP_PAGE_ROUTES[] PROGMEM = {
+  {S_URL_STATUS, HTTP_PAGE_STATUS},
+  {S_URL_API_LOG, HTTP_PAGE_API_LOG},
+  {S_URL_API_LOG_ALL, HTTP_PAGE_API_LOG_ALL},
+  {S_URL_API_STATUS, HTTP_PAGE_API_STATUS},
+  {S_URL_HARDWARE, HTTP_PAGE_HARDWARE},
+  {S_URL_DAILY_LOG, HTTP_PAGE_DAILY_LOG},
+  {S_URL_GENERAL_OPTIONS, HTTP_PAGE_GENERAL_OPTIONS},
+  {S_URL_GENERAL_OPTIONS_SUMMARY, HTTP_PAGE_GENERAL_OPTIONS_SUMMARY},
+  {S_URL_OTHER_PAGE, HTTP_PAGE_OTHER},
+  {S_URL_DUMP_AT24C32, HTTP_PAGE_DUMP_AT24C32},
+  {S_URL_DUMP_INTERNAL, HTTP_PAGE_DUMP_INTERNAL},
+  {S_URL_PINMAP, HTTP_PAGE_PINMAP},
+  {S_URL_STATIC_STYLE, HTTP_PAGE_STATIC_STYLE},
+  {S_URL_STATIC_SCRIPT, HTTP_PAGE_STATIC_SCRIPT},
+  {S_URL_STATIC_LOG_DESCRIPTIONS, HTTP_PAGE_STATIC_LOG_DESCRIPTIONS},
+  {S_URL_WATERING, HTTP_PAGE_WATERING}
+};
+
+// Watering pages have system number suffix, like "/watering/2"
+byte WebServerClass::findHttpPage(const char* url, byte& wsIndex) {
+  wsIndex = 0xFF;
+  byte page = findProgMemRoute(HTTP_PAGE_ROUTES, sizeof(HTTP_PAGE_ROUTES) / sizeof(ProgMemRoute), url, HTTP_PAGE_NOT_FOUND);
+  if (page == HTTP_PAGE_WATERING) {
+    wsIndex = 0;
+  }
+  else if (page == HTTP_PAGE_NOT_FOUND) {
+    size_t prefixLength = StringUtils::flashStringLength(FS(S_URL_WATERING));
+    if (strncmp_P(url, S_URL_WATERING, prefixLength) == 0 && url[prefixLength] == '/' &&
+        url[prefixLength + 1] >= '1' && url[prefixLength + 1] < '1' + MAX_WATERING_SYSTEMS_COUNT && url[prefixLength + 2] == 0x00) {
+      wsIndex = url[prefixLength + 1] - '1';
+      page = HTTP_PAGE_WATERING;
+    }
+  }
+  return page;
+}
 
-  boolean isConfigurationPage = (isGeneralOptionsPage || isGeneralOptionsSummaryPage || isWateringPage || isHardwarePage || isOtherPage || isDumpInternal || isDumpAT24C32 || isPinMapPage);
+void WebServerClass::httpProcessGet(const char* url, char* getParams, const char* ifNoneMatch, boolean isGzipAccepted) {
 
-  boolean isValidPage = (isStatusPage || isLogPage || isConfigurationPage);
-  if (!isValidPage) {
+  byte wsIndex; // FF if not watering system
+  byte page = findHttpPage(url, wsIndex);
+  if (page == HTTP_PAGE_NOT_FOUND) {
     httpNotFound();
     return;
   }
+  if (page == HTTP_PAGE_API_STATUS) {
+    sendStatusJson();
+    return;
+  }
+  if (page == HTTP_PAGE_API_LOG) {
+    parseHttpParams(getParams);
+    sendLogApi();
+    return;
+  }
+  if (page == HTTP_PAGE_API_LOG_ALL) {
+    sendLogRecordsStream();
+    return;
+  }
+  if (page == HTTP_PAGE_STATIC_STYLE) {
+    httpStaticFile(ifNoneMatch, isGzipAccepted, F("text/css"), FS(S_STATIC_STYLE), S_STATIC_STYLE_GZIP, sizeof(S_STATIC_STYLE_GZIP));
+    return;
+  }
+  if (page == HTTP_PAGE_STATIC_SCRIPT) {
+    httpStaticFile(ifNoneMatch, isGzipAccepted, F("application/javascript"), FS(S_STATIC_SCRIPT), S_STATIC_SCRIPT_GZIP, sizeof(S_STATIC_SCRIPT_GZIP));
+    return;
+  }
+  if (page == HTTP_PAGE_STATIC_LOG_DESCRIPTIONS) {
+    sendLogDescriptionsScript(ifNoneMatch);
+    return;
+  }
+
+  parseHttpParams(getParams);
+
+  boolean isStatusPage = (page == HTTP_PAGE_STATUS);
+  boolean isLogPage = (page == HTTP_PAGE_DAILY_LOG);
+
+  boolean isGeneralOptionsPage = (page == HTTP_PAGE_GENERAL_OPTIONS);
+  boolean isGeneralOptionsSummaryPage = (page == HTTP_PAGE_GENERAL_OPTIONS_SUMMARY);
+  boolean isWateringPage = (page == HTTP_PAGE_WATERING);
+  boolean isHardwarePage = (page == HTTP_PAGE_HARDWARE);
+  boolean isOtherPage = (page == HTTP_PAGE_OTHER);
+  boolean isDumpInternal = (page == HTTP_PAGE_DUMP_INTERNAL);
+  boolean isDumpAT24C32 = (page == HTTP_PAGE_DUMP_AT24C32);
+  boolean isPinMapPage = (page == HTTP_PAGE_PINMAP);
+
+  boolean isConfigurationPage = (!isStatusPage && !isLogPage);
 
   httpPageHeader();
 
@@ -51,19 +141,12 @@ void WebServerClass::httpProcessGet(const String& url, const String& getParams)
   rawData(F("<html><head>"));{
     rawData(F("<title>Growbox</title>"));
     rawData(F("<meta name='viewport' content='width=device-width, initial-scale=1'/>"));
-    rawData(F("<style type='text/css'>"));{
-      rawData(F("body{font-family:Arial;max-width:600px; }")); // 350px
-      rawData(F("form{margin: 0px;}"));
-      rawData(F("dt{font-weight:bold; margin-top:5px;}"));
-
-      rawData(F(".red {color: red;}"));
-      rawData(F(".grab {border-spacing:5px;width:100%; }"));
-      rawData(F(".align_left{float:left;text-align:left;}"));
-      rawData(F(".align_center{float:center;text-align:center;}"));
-      rawData(F(".align_right{float:right;text-align:right;}"));
-      rawData(F(".description{font-size:small;margin-left:20px;margin-bottom:5px;}"));
-    }
-    rawData(F("</style>"));
+    rawData(F("<link rel='stylesheet' type='text/css' href='"));
+    rawData(FS(S_URL_STATIC_STYLE));
+    rawData(F("'/>"));
+    rawData(F("<script type='text/javascript' src='"));
+    rawData(FS(S_URL_STATIC_SCRIPT));
+    rawData(F("'></script>"));
   }
 
   rawData(F("</head>"));
@@ -91,14 +174,12 @@ void WebServerClass::httpProcessGet(const String& url, const String& getParams)
     tagOption(FS(S_URL_GENERAL_OPTIONS_SUMMARY), F("General options: Summary"), isGeneralOptionsSummaryPage);
   }
   for (byte i = 0; i < MAX_WATERING_SYSTEMS_COUNT; i++) {
-    String url = StringUtils::flashStringLoad(FS(S_URL_WATERING));
-    if (i > 0) {
-      url += '/';
-      url += (i + 1);
-    }
-    String description = StringUtils::flashStringLoad(F("Watering system #"));
-    description += (i + 1);
-    tagOption(url, description, (wsIndex == i));
+    tagOptionBegin(wsIndex == i);
+    printWateringUrl(i);
+    tagOptionText();
+    rawData(F("Watering system #"));
+    rawData(i + 1);
+    tagOptionEnd();
   }
 
   tagOption(FS(S_URL_HARDWARE), F("Hardware"), isHardwarePage);
@@ -115,45 +196,37 @@ void WebServerClass::httpProcessGet(const String& url, const String& getParams)
   rawData(F("</select>"));
   rawData(F("</form>"));
 
-  rawData(F("<script type='text/javascript'>"));
-  rawData(F("var g_configPageSelect = document.getElementById('configPageSelect');"));
-  rawData(F("var g_configPageSelectedDefault = g_configPageSelect.value;"));
-  rawData(F("function g_onChangeConfigPageSelect(event) {"));{
-    rawData(F("var newValue = g_configPageSelect.value;"));
-    rawData(F("g_configPageSelect.value = g_configPageSelectedDefault;"));
-    rawData(F("location = newValue;"));
-  }
-  rawData(F("}"));
-  rawData(F("</script>"));
-
   rawData(F("<hr/>"));
 
-  if (isStatusPage) {
-    sendStatusPage();
-  }
-  else if (isLogPage) {
-    sendLogPage(getParams);
-  }
-  else if (isGeneralOptionsPage) {
-    sendGeneralOptionsPage(getParams);
-  }
-  else if (isGeneralOptionsSummaryPage) {
-    sendGeneralOptionsSummaryPage();
-  }
-  else if (isWateringPage) {
-    sendWateringOptionsPage(url, wsIndex);
-  }
-  else if (isHardwarePage) {
-    sendHardwareOptionsPage(getParams);
-  }
-  else if (isOtherPage) {
-    sendOtherOptionsPage(getParams);
-  }
-  else if (isDumpInternal || isDumpAT24C32) {
-    sendStorageDumpPage(getParams, isDumpInternal);
-  }
-  else if (isPinMapPage) {
-    sendPinMapPage();
+  switch (page) {
+    case HTTP_PAGE_STATUS:
+      sendStatusPage();
+      break;
+    case HTTP_PAGE_DAILY_LOG:
+      sendLogPage();
+      break;
+    case HTTP_PAGE_GENERAL_OPTIONS:
+      sendGeneralOptionsPage();
+      break;
+    case HTTP_PAGE_GENERAL_OPTIONS_SUMMARY:
+      sendGeneralOptionsSummaryPage();
+      break;
+    case HTTP_PAGE_WATERING:
+      sendWateringOptionsPage(url, wsIndex);
+      break;
+    case HTTP_PAGE_HARDWARE:
+      sendHardwareOptionsPage();
+      break;
+    case HTTP_PAGE_OTHER:
+      sendOtherOptionsPage();
+      break;
+    case HTTP_PAGE_DUMP_INTERNAL:
+    case HTTP_PAGE_DUMP_AT24C32:
+      sendStorageDumpPage(isDumpInternal);
+      break;
+    case HTTP_PAGE_PINMAP:
+      sendPinMapPage();
+      break;
   }
 
   rawData(F("</body></html>"));
@@ -199,7 +272,7 @@ void WebServerClass::sendStatusPage() {
   if (isDayInGrowbox) {
     rawData(F("<b>"));
   }
-  rawData(StringUtils::wordTimeToString(dayPeriod));
+  PrintUtils::printWordTime(*this, dayPeriod);
   if (isDayInGrowbox) {
     rawData(F("</b>"));
   }
@@ -207,7 +280,7 @@ void WebServerClass::sendStatusPage() {
   if (!isDayInGrowbox) {
     rawData(F("<b>"));
   }
-  rawData(StringUtils::wordTimeToString(nightPeriod));
+  PrintUtils::printWordTime(*this, nightPeriod);
   if (!isDayInGrowbox) {
     rawData(F("</b>"));
   }
@@ -270,7 +343,7 @@ void WebServerClass::sendStatusPage() {
   rawData(F("<br/><small><span id='diffTimeStampId'>Wait just a little</span></small>"));
   rawData(F("<form action='"));
   rawData(FS(S_URL_STATUS));
-  rawData(F("' method='post' onSubmit='return g_checkBeforeSetClockTime()'>"));
+  rawData(F("' method='post' onSubmit='return g_checkBeforeSetClockTime(\"setClockTimeInput\")'>"));
   rawData(F("<input type='hidden' name='setClockTime' id='setClockTimeInput'>"));
   rawData(F("<input type='submit' value='Sync'>"));
   rawData(F("</form>"));
@@ -387,246 +460,302 @@ void WebServerClass::sendStatusPage() {
 
   rawData(F("</dl>"));
 
-  growboxClockJavaScript(F("growboxTimeStampId"), NULL, F("diffTimeStampId"), F("setClockTimeInput"));
+  growboxClockJavaScript(F("growboxTimeStampId"), NULL, F("diffTimeStampId"));
 
 }
 
 /////////////////////////////////////////////////////////////////////
-//                             LOG PAGE                            //
+//                         STATUS JSON API                         //
 /////////////////////////////////////////////////////////////////////
-boolean WebServerClass::isSameDay(tmElements_t time1, tmElements_t time2){
-  return (time1.Day == time2.Day && time1.Month == time2.Month && time1.Year == time2.Year);
+
+void WebServerClass::jsonField(const __FlashStringHelper* name, boolean isFirst) {
+  if (!isFirst) {
+    rawData(',');
+  }
+  rawData('"');
+  rawData(name);
+  rawData(F("\":"));
 }
 
-void WebServerClass::sendLogPage(const String& getParams) {
+void WebServerClass::jsonBoolean(boolean value) {
+  rawData(value ? F("true") : F("false"));
+}
 
-  tmElements_t targetDayTm;
-  String paramValue;
+void WebServerClass::jsonTemperature(float t) {
+  if (isnan(t)) {
+    rawData(F("null"));
+  }
+  else {
+    rawData(t);
+  }
+}
 
-  // get target Day
-  boolean printAllDays = false;
-  boolean isTargetDayInParameter = false;
-  if (searchHttpParamByName(getParams, F("date"), paramValue)) {
-    if (StringUtils::flashStringEquals(paramValue, F("all"))) {
-      printAllDays = true;
-      isTargetDayInParameter = true;
-    }
-    else if (paramValue.length() == 10) {
-      byte dayInt = paramValue.substring(0, 2).toInt();
-      byte monthInt = paramValue.substring(3, 5).toInt();
-      word yearInt = paramValue.substring(6, 10).toInt();
+// Seconds since 1970 in Growbox time zone, null if not set
+void WebServerClass::jsonTimeStamp(time_t time) {
+  if (time == 0) {
+    rawData(F("null"));
+  }
+  else {
+    rawData(time, true);
+  }
+}
 
-      if (dayInt != 0 && monthInt != 0 && yearInt != 0) {
-        targetDayTm.Day = dayInt;
-        targetDayTm.Month = monthInt;
-        targetDayTm.Year = CalendarYrToTm(yearInt);
-        isTargetDayInParameter = true;
-      }
-    }
+// Relay state is null, if relay is not used
+void WebServerClass::jsonRelay(boolean isUsed, boolean isTurnedOn) {
+  if (isUsed) {
+    jsonBoolean(isTurnedOn);
   }
-  if (!isTargetDayInParameter) {
-    breakTime(now(), targetDayTm);
+  else {
+    rawData(F("null"));
   }
+}
 
-  boolean printAll = false, printEvents = false, printWateringEvents = false, printErrors = false, printTemperature = false;
-  if (searchHttpParamByName(getParams, F("type"), paramValue)) {
-    if (StringUtils::flashStringEquals(paramValue, F("events"))) {
-      printEvents = true;
-    }
-    else if (StringUtils::flashStringEquals(paramValue, F("wateringevents"))) {
-      printWateringEvents = true;
-    }
-    else if (StringUtils::flashStringEquals(paramValue, F("errors"))) {
-      printErrors = true;
+// Snapshot of state cached by controller, for machine polling. Unlike status page,
+// sensors, RTC and external EEPROM are not read here
+void WebServerClass::sendStatusJson() {
+
+  httpJsonHeader();
+
+  rawData('{');
+  jsonField(F("time"), true);
+  jsonTimeStamp(now());
+  jsonField(F("startup"));
+  jsonTimeStamp(GB_StorageHelper.getStartupTimeStamp());
+  jsonField(F("clockNotSet"));
+  jsonBoolean(GB_Controller.isClockNotSet());
+  jsonField(F("clockNeedsSync"));
+  jsonBoolean(GB_Controller.isClockNeedsSync());
+  jsonField(F("breezeError"));
+  jsonBoolean(GB_Controller.isBreezeFatalError());
+
+  jsonField(F("mode"));
+  rawData(GB_Controller.isDayInGrowbox() ? F("\"day\"") : F("\"night\""));
+  jsonField(F("light"));
+  jsonRelay(GB_Controller.isUseLight(), GB_Controller.isLightTurnedOn());
+  jsonField(F("fan"));
+  jsonRelay(GB_Controller.isUseFan(), GB_Controller.isFanHardwareTurnedOn());
+  jsonField(F("heater"));
+  jsonRelay(GB_Controller.isUseHeater(), GB_Controller.isHeaterTurnedOn());
+
+  jsonField(F("thermometer"));
+  if (GB_Thermometer.isUseThermometer()) {
+    int forecastCount = GB_Thermometer.getForecastMeasurementCount();
+    rawData('{');
+    jsonField(F("last"), true);
+    jsonTemperature(GB_Thermometer.getLastTemperature());
+    jsonField(F("forecast"));
+    jsonTemperature(forecastCount > 0 ? GB_Thermometer.getForecastTemperature() : NAN); // empty forecast is measured
+    jsonField(F("forecastCount"));
+    rawData(forecastCount);
+    rawData('}');
+  }
+  else {
+    rawData(F("null"));
+  }
+
+  // Values of last wet sensors update, null if sensor or pump is not connected
+  jsonField(F("watering"));
+  rawData('[');
+  for (byte wsIndex = 0; wsIndex < MAX_WATERING_SYSTEMS_COUNT; wsIndex++) {
+    BootRecord::WateringSystemPreferencies wsp = GB_StorageHelper.getWateringSystemPreferenciesById(wsIndex);
+    if (wsIndex > 0) {
+      rawData(',');
     }
-    else if (StringUtils::flashStringEquals(paramValue, F("temperature"))) {
-      printTemperature = true;
+    rawData('{');
+    jsonField(F("wet"), true);
+    byte value = GB_Watering.getCurrentWetSensorValue(wsIndex);
+    if (wsp.boolPreferencies.isWetSensorConnected && !GB_Watering.isWetSensorValueReserved(value)) {
+      rawData(value);
     }
     else {
-      printAll = true;
+      rawData(F("null"));
     }
-  } else {
-    printAll = true;
+    jsonField(F("lastWatering"));
+    jsonTimeStamp(wsp.boolPreferencies.isWaterPumpConnected ? GB_Watering.getLastWateringTimeStampByIndex(wsIndex) : 0);
+    jsonField(F("nextWatering"));
+    jsonTimeStamp(wsp.boolPreferencies.isWaterPumpConnected ? GB_Watering.getNextWateringTimeStampByIndex(wsIndex) : 0);
+    rawData('}');
   }
+  rawData(']');
 
-  if (c_isWifiResponseError){
-    return;
+  jsonField(F("log"));
+  rawData('{');
+  jsonField(F("enabled"), true);
+  jsonBoolean(GB_StorageHelper.isStoreLogRecordsEnabled());
+  jsonField(F("count"));
+  if (GB_StorageHelper.isLogRecordsCountKnown()) { // log is not scanned for status
+    rawData(GB_StorageHelper.getLogRecordsCount());
+  }
+  else {
+    rawData(F("null"));
   }
+  jsonField(F("capacity"));
+  rawData(GB_StorageHelper.getLogRecordsCapacity());
+  jsonField(F("overflow"));
+  jsonBoolean(GB_StorageHelper.isLogOverflow());
+  rawData('}');
 
-  rawData(F("<form action='"));
-  rawData(FS(S_URL_DAILY_LOG));
-  rawData(F("' method='get'>"));
+  jsonField(F("freeMemory"));
+  rawData(freeMemory());
+  rawData('}');
 
-  rawData(F("<select id='typeCombobox' name='type'>"));
-  tagOption(F("all"), F("All types"), printAll);
-  tagOption(F("events"), F("Events only"), printEvents);
-  tagOption(F("wateringevents"), F("Watering Events only"), printWateringEvents);
-  tagOption(F("errors"), F("Errors only"), printErrors);
-  tagOption(F("temperature"), F("Temperature only"), printTemperature);
-  rawData(F("</select>"));
+  httpPageComplete();
+}
 
-//  String text = StringUtils::flashStringLoad(F("All days  ("));
-//  text += GB_StorageHelper.getLogRecordsCount();
-//  text += StringUtils::flashStringLoad(F(")"));
+/////////////////////////////////////////////////////////////////////
+//                             LOG API                             //
+/////////////////////////////////////////////////////////////////////
 
-  rawData(F("<select id='dateCombobox' name='date'>"));
-  //tagOption(F("all"), text, printAllDays);
-  // Other will append by java script
-  rawData(F("</select>"));
-  rawData(F("<input type='submit' value='Show'/>"));
-  rawData(F("</form>"));
+void WebServerClass::rawLittleEndian(unsigned long value, byte size) {
+  for (byte i = 0; i < size; i++) {
+    write((uint8_t) (value >> (8 * i)));
+  }
+}
 
-  LogRecord logRecord, nextLogRecord;
-  tmElements_t currentDayTm, nextDayTm;
+void WebServerClass::rawLogRecord(const LogRecord& logRecord) {
+  rawLittleEndian(logRecord.timeStamp, 4);
+  write(logRecord.data);
+  write(logRecord.data1);
+}
 
-  boolean isTableTagPrinted = false;
-  word currentDayRecordsCount = 0, currentDayPrintableRecordsCount = 0, allPrintableRecordsCount = 0;
-  for (word logRecordIndex = 0; logRecordIndex < GB_StorageHelper.getLogRecordsCount(); logRecordIndex++) {
+// Records after cursor, for external log collector: GET /api/log?cursor=N&count=N. Cursor of next batch is
+// returned with records, collector polls with it and reads only new records. Without cursor log is read from
+// first record with time stamp not less than "from" one, or from oldest record.
+// See StorageHelperClass::getLogRecordsToken()
+void WebServerClass::sendLogApi() {
 
-    if (c_isWifiResponseError) {
-      return;
+  byte maxCount = LOG_API_BATCH_MAX_SIZE;
+  const char* countParam = getHttpParam(F("count"));
+  if (countParam != NULL) {
+    int count = atoi(countParam);
+    if (count > 0 && count < maxCount) {
+      maxCount = count;
     }
+  }
 
-    // get current day info
-    if (logRecordIndex == 0){
-      logRecord = GB_StorageHelper.getLogRecordByIndex(logRecordIndex);
-    } else {
-      logRecord = nextLogRecord;
-    }
-    breakTime(logRecord.timeStamp, currentDayTm);
+  byte flags = 0;
+  LogRecordsCursor cursor;
+  const char* cursorParam = getHttpParam(F("cursor"));
+  const char* fromParam = getHttpParam(F("from"));
+  if (cursorParam == NULL && fromParam != NULL) {
+    GB_StorageHelper.findLogRecordByTime(cursor, strtoul(fromParam, NULL, 10)); // cursor is on log end, if not found
+  }
+  else if (cursorParam == NULL) {
+    GB_StorageHelper.openLogRecordsCursor(cursor);
+  }
+  else if (!GB_StorageHelper.openLogRecordsCursorByToken(cursor, strtoul(cursorParam, NULL, 10))) {
+    GB_StorageHelper.openLogRecordsCursor(cursor);
+    flags |= LOG_API_FLAG_CURSOR_LOST;
+  }
 
-    // is last record in current day?
-    boolean isLastRecordInCurrentDay = false;
-    if (logRecordIndex == GB_StorageHelper.getLogRecordsCount()-1){
-      isLastRecordInCurrentDay = true;
-    } else {
-      nextLogRecord = GB_StorageHelper.getLogRecordByIndex(logRecordIndex+1);
-      breakTime(nextLogRecord.timeStamp, nextDayTm);
-      isLastRecordInCurrentDay = !isSameDay(currentDayTm, nextDayTm);
-    }
+  LogRecord logRecords[LOG_API_BATCH_MAX_SIZE];
+  byte count = 0;
+  word nextPosition = cursor.position;
+  while (count < maxCount && GB_StorageHelper.nextLogRecord(cursor, logRecords[count])) {
+    nextPosition = cursor.position; // position after returned record, finished cursor has no position
+    count++;
+  }
+  LogRecord logRecord;
+  if (count == maxCount && GB_StorageHelper.nextLogRecord(cursor, logRecord)) {
+    flags |= LOG_API_FLAG_HAS_MORE;
+  }
+  unsigned long nextCursor = GB_StorageHelper.getLogRecordsToken(nextPosition);
 
-    // increase independent counters
-    currentDayRecordsCount++;
-
-    boolean isEvent         = GB_Logger.isEvent(logRecord);
-    boolean isWateringEvent = GB_Logger.isWateringEvent(logRecord);
-    boolean isError         = GB_Logger.isError(logRecord);
-    boolean isTemperature   = GB_Logger.isTemperature(logRecord);
-
-    boolean isPassTypeFilter = (
-        (printAll) ||
-        (printEvents && isEvent) ||
-        (printWateringEvents && isWateringEvent) ||
-        (printErrors && isError) ||
-        (printTemperature && isTemperature));
-
-    if (isPassTypeFilter) {
-      // increase printable counters
-      currentDayPrintableRecordsCount++;
-      allPrintableRecordsCount++;
-    }
+  RAK410_XBeeWifi.sendAutoSizeFrameStart(c_wifiPortDescriptor);
+  rawData(F("HTTP/1.1 200 OK\r\n"));
+  httpConnectionHeader(true);
+  rawData(F("Cache-Control: no-cache\r\nContent-Type: application/octet-stream\r\nContent-Length: "));
+  rawData((word) (LOG_API_HEADER_SIZE + count * LOG_API_RECORD_SIZE));
+  rawData(FS(S_CRLFCRLF));
 
-    // add date to combo box
-    if (isLastRecordInCurrentDay){
-      String value = StringUtils::timeStampToString(logRecord.timeStamp, true, false);
-      String text = value + StringUtils::flashStringLoad(F("  ("));
-      if (!printAll){
-        text += currentDayPrintableRecordsCount;
-        text +='/';
-      }
-      text += currentDayRecordsCount;
-      text += ')';
-      appendOptionToSelectDynamic(F("dateCombobox"), value, text, !printAllDays && isSameDay(currentDayTm, targetDayTm));
-    }
+  write(LOG_API_FORMAT_VERSION);
+  write(flags);
+  write(count);
+  rawLittleEndian(nextCursor, 4);
+  for (byte i = 0; i < count; i++) {
+    rawLogRecord(logRecords[i]);
+  }
 
-    if (isPassTypeFilter && (printAllDays || isSameDay(currentDayTm, targetDayTm))) {
-      // Print table row
-      if (!isTableTagPrinted) {
-        isTableTagPrinted = true;
-        rawData(F("<table class='grab align_center'>"));
-        rawData(F("<tr>"));
-        rawData(F("<th>#</th>"));
-        if (printAllDays){
-          rawData(F("<th>Day</th>"));
-        }
-        rawData(F("<th>Time</th><th>Description</th></tr>"));
-      }
-      rawData(F("<tr>"));
+  httpPageComplete();
+}
 
-      rawData(F("<td>"));
-      if (printAllDays) {
-        rawData(allPrintableRecordsCount);
-      } else {
-        rawData(currentDayPrintableRecordsCount);
-      }
-      rawData(F("</td>"));
+// All records for log page, without header and cursor
+void WebServerClass::sendLogRecordsStream() {
+  RAK410_XBeeWifi.sendAutoSizeFrameStart(c_wifiPortDescriptor);
+  rawData(F("HTTP/1.1 200 OK\r\nCache-Control: no-cache\r\nContent-Type: application/octet-stream\r\n"));
+  httpStreamHeaderComplete();
 
-      if (printAllDays){
-        rawData(F("<td style='font-weight:bold;'>"));
-        if (currentDayPrintableRecordsCount == 1){
-          rawData(StringUtils::timeStampToString(logRecord.timeStamp, true, false));
-        }
-        rawData(F("</td>"));
-      }
-      rawData(F("<td>"));
-      rawData(StringUtils::timeStampToString(logRecord.timeStamp, false, true));
-      rawData(F("</td><td style='text-align:left;"));
-      if (isError || logRecord.isEmpty()) {
-        rawData(F("color:red;"));
-      }
-      else if (isEvent && (logRecord.data == EVENT_FIRST_START_UP.index || logRecord.data == EVENT_RESTART.index)) { // TODO create check method in Logger.h
-        rawData(F("font-weight:bold;"));
-      }
-      rawData(F("'>"));
+  LogRecordsCursor cursor;
+  LogRecord logRecord;
+  GB_StorageHelper.openLogRecordsCursor(cursor);
+  while (!c_isWifiResponseError && GB_StorageHelper.nextLogRecord(cursor, logRecord)) {
+    rawLogRecord(logRecord);
+  }
 
-      rawData(GB_Logger.getLogRecordDescription(logRecord));
-      rawData(GB_Logger.getLogRecordDescriptionSuffix(logRecord, true));
-      rawData(F("</td></tr>")); // bug with linker was here https://github.com/arduino/Arduino/issues/1071#issuecomment-19832135
-    }
+  httpPageComplete();
+}
 
-    if (isLastRecordInCurrentDay){ // on day change reset counters
-      currentDayRecordsCount = 0;
-      currentDayPrintableRecordsCount = 0;
-    }
+/////////////////////////////////////////////////////////////////////
+//                             LOG PAGE                            //
+/////////////////////////////////////////////////////////////////////
+// Cached by browser like static files, see LoggerClass::printLogRecordDescriptionsScript()
+void WebServerClass::sendLogDescriptionsScript(const char* ifNoneMatch) {
+  if (!httpStaticFileHeader(ifNoneMatch, F("application/javascript"), false, 0)) {
+    return;
   }
+  GB_Logger.printLogRecordDescriptionsScript(*this);
+  httpPageComplete();
+}
 
-  if (isTableTagPrinted) {
-    rawData(F("</table>"));
-  }
-  else {
-    String value = StringUtils::timeStampToString(makeTime(targetDayTm), true, false);
-    String text = value + StringUtils::flashStringLoad(F("  ("));
-    if (!printAll){
-      text += StringUtils::flashStringLoad(F("0/"));
+// Page has filters only. Browser loads raw records from S_URL_API_LOG_ALL and renders table
+// and days, see g_showLog() in Static/growbox.js
+void WebServerClass::sendLogPage() {
+
+  const char* type = getHttpParam(F("type"));
+  boolean printEvents = (type != NULL && StringUtils::flashStringEquals(type, F("events")));
+  boolean printWateringEvents = (type != NULL && StringUtils::flashStringEquals(type, F("wateringevents")));
+  boolean printErrors = (type != NULL && StringUtils::flashStringEquals(type, F("errors")));
+  boolean printTemperature = (type != NULL && StringUtils::flashStringEquals(type, F("temperature")));
+  boolean printAll = !(printEvents || printWateringEvents || printErrors || printTemperature);
+
+  // "all" or dd.mm.yyyy, today by default
+  const char* date = getHttpParam(F("date"));
+  if (date != NULL && !StringUtils::flashStringEquals(date, F("all"))) {
+    boolean isDate = (strlen(date) == 10);
+    for (byte i = 0; isDate && i < 10; i++) {
+      isDate = (i == 2 || i == 5) ? (date[i] == '.') : isdigit(date[i]);
     }
-    text += '0';
-    text += ')';
-    appendOptionToSelectDynamic(F("dateCombobox"), value, text, true); // TODO Maybe will append not in correct position
-    rawData(F("<br/>"));
-    if (printEvents) {
-      rawData(F("Event"));
-    } else if (printWateringEvents) {
-      rawData(F("Watering event"));
-    } else if (printErrors) {
-      rawData(F("Error "));
-    } else if (printTemperature) {
-      rawData(F("Temperature"));
-    } else {
-      rawData(F("Log"));
+    if (!isDate) {
+      date = NULL;
     }
-    rawData(F(" records not found for "));
-    rawData(value);
   }
 
-  String text = StringUtils::flashStringLoad(F("All days  ("));
-  if (!printAll){
-    text += allPrintableRecordsCount;
-    text +='/';
-  }
-  text += GB_StorageHelper.getLogRecordsCount();
-  text += ')';
-  appendOptionToSelectDynamic(F("dateCombobox"), F("all"), text, printAllDays);
+  rawData(F("<script type='text/javascript' src='"));
+  rawData(FS(S_URL_STATIC_LOG_DESCRIPTIONS));
+  rawData(F("'></script>"));
 
+  rawData(F("<form>"));
+  rawData(F("<select id='typeCombobox' onchange='g_updateLog();'>"));
+  tagOption(F("all"), F("All types"), printAll);
+  tagOption(F("events"), F("Events only"), printEvents);
+  tagOption(F("wateringevents"), F("Watering Events only"), printWateringEvents);
+  tagOption(F("errors"), F("Errors only"), printErrors);
+  tagOption(F("temperature"), F("Temperature only"), printTemperature);
+  rawData(F("</select>"));
+  rawData(F("<select id='dateCombobox' onchange='g_updateLog();'></select>"));
+  rawData(F("</form>"));
+  rawData(F("<div id='logTable'>Loading...</div>"));
+
+  rawData(F("<script type='text/javascript'>g_showLog('"));
+  rawData(FS(S_URL_API_LOG_ALL));
+  rawData(F("','"));
+  if (date != NULL) {
+    rawData(date);
+  }
+  else {
+    PrintUtils::printTimeStamp(*this, now(), true, false);
+  }
+  rawData(F("');</script>"));
 }
 
 /////////////////////////////////////////////////////////////////////
@@ -663,18 +792,19 @@ void WebServerClass::sendGeneralOptionsPage_FanParameterRow(const __FlashStringH
     byte l_numerator, l_denominator;
     GB_Controller.getNumeratorDenominatorByIndex(index, l_numerator, l_denominator);
 
-    String value(index);
-    String valueDescription (l_numerator * UPDATE_GROWBOX_STATE_DELAY_MINUTES);
-    valueDescription += '/';
-    valueDescription += l_denominator * UPDATE_GROWBOX_STATE_DELAY_MINUTES;
-    tagOption(value, valueDescription, l_numerator == numerator && l_denominator == denominator);
+    tagOptionBegin(index, DEC, l_numerator == numerator && l_denominator == denominator);
+    tagOptionText();
+    rawData(l_numerator * UPDATE_GROWBOX_STATE_DELAY_MINUTES);
+    rawData('/');
+    rawData(l_denominator * UPDATE_GROWBOX_STATE_DELAY_MINUTES);
+    tagOptionEnd();
   }
   rawData(F("</select>"));
 
   rawData(F("</td><td></td></tr>"));
 }
 
-void WebServerClass::sendGeneralOptionsPage(const String& getParams) {
+void WebServerClass::sendGeneralOptionsPage() {
 
   word upTime, downTime;
   GB_StorageHelper.getTurnToDayAndNightTime(upTime, downTime);
@@ -694,9 +824,9 @@ void WebServerClass::sendGeneralOptionsPage(const String& getParams) {
   rawData(F("</td></tr>"));
 
   rawData(F("<tr><td>Day/Night period</td><td><span id='dayNightPeriod'>"));
-  rawData(StringUtils::wordTimeToString(dayPeriod));
+  PrintUtils::printWordTime(*this, dayPeriod);
   rawData(F("/"));
-  rawData(StringUtils::wordTimeToString(nightPeriod));
+  PrintUtils::printWordTime(*this, nightPeriod);
   rawData(F("</span></td></tr>"));
 
   rawData(F("<tr><td>Auto adjust time</td><td>"));
@@ -861,9 +991,9 @@ void WebServerClass::sendGeneralOptionsSummaryPage_ModeRow(const __FlashStringHe
   rawData(F("<td>"));
   if (startTime != 0xFFFF || stopTime != 0xFFFF) {
     rawData(F("<b>"));
-    rawData(StringUtils::wordTimeToString(startTime));
+    PrintUtils::printWordTime(*this, startTime);
     rawData(F(".."));
-    rawData(StringUtils::wordTimeToString(stopTime));
+    PrintUtils::printWordTime(*this, stopTime);
     rawData(F("</b>"));
   }
   rawData(F("</td>"));
@@ -1036,41 +1166,28 @@ void WebServerClass::sendGeneralOptionsSummaryPage() {
 //                         WATERING PAGE                           //
 /////////////////////////////////////////////////////////////////////
 
-byte WebServerClass::getWateringIndexFromUrl(const String& url) {
-
-  if (!StringUtils::flashStringStartsWith(url, FS(S_URL_WATERING))) {
-    return 0xFF;
-  }
-
-  String urlSuffix = url.substring(StringUtils::flashStringLength(FS(S_URL_WATERING)));
-  if (urlSuffix.length() == 0) {
-    return 0;
-  }
-
-  urlSuffix = urlSuffix.substring(urlSuffix.length() - 1);  // remove left slash
-
-  byte wateringSystemIndex = urlSuffix.toInt();
-  wateringSystemIndex--;
-  if (wateringSystemIndex < 0 || wateringSystemIndex >= MAX_WATERING_SYSTEMS_COUNT) {
-    return 0xFF;
-  }
-  return wateringSystemIndex;
+byte WebServerClass::getWateringIndexFromUrl(const char* url) {
+  byte wsIndex;
+  findHttpPage(url, wsIndex);
+  return wsIndex;
 }
 
-void WebServerClass::sendWateringOptionsPage(const String& url, byte wsIndex) {
-
-  String actionURL;
-  actionURL += StringUtils::flashStringLoad(FS(S_URL_WATERING));
+// First watering system has short URL, see findHttpPage()
+void WebServerClass::printWateringUrl(byte wsIndex) {
+  rawData(FS(S_URL_WATERING));
   if (wsIndex > 0) {
-    actionURL += '/';
-    actionURL += (wsIndex + 1);
+    rawData('/');
+    rawData(wsIndex + 1);
   }
+}
+
+void WebServerClass::sendWateringOptionsPage(const char* url, byte wsIndex) {
 
   BootRecord::WateringSystemPreferencies wsp = GB_StorageHelper.getWateringSystemPreferenciesById(wsIndex);
 
   // run Dry watering form
   rawData(F("<form action='"));
-  rawData(actionURL);
+  printWateringUrl(wsIndex);
   rawData(F("' method='post' id='runDryWateringNowForm' onSubmit='return confirm(\"Start manually Dry watering during "));
   rawData(wsp.dryWateringDuration);
   rawData(F(" sec ?\")'>"));
@@ -1079,7 +1196,7 @@ void WebServerClass::sendWateringOptionsPage(const String& url, byte wsIndex) {
 
   // clearLastWateringTimeForm
   rawData(F("<form action='"));
-  rawData(actionURL);
+  printWateringUrl(wsIndex);
   rawData(F("' method='post' id='clearLastWateringTimeForm' onSubmit='return confirm(\"Clear last watering time?\")'>"));
   rawData(F("<input type='hidden' name='clearLastWateringTime'>"));
   rawData(F("</form>"));
@@ -1099,7 +1216,7 @@ void WebServerClass::sendWateringOptionsPage(const String& url, byte wsIndex) {
 
   rawData(F("<fieldset><legend>General</legend>"));
   rawData(F("<form action='"));
-  rawData(actionURL);
+  printWateringUrl(wsIndex);
   rawData(F("' method='post'>"));
 
   tagCheckbox(F("isWetSensorConnected"), F("Wet sensor connected"), wsp.boolPreferencies.isWetSensorConnected);
@@ -1156,7 +1273,7 @@ void WebServerClass::sendWateringOptionsPage(const String& url, byte wsIndex) {
 
   rawData(F("<fieldset><legend>Wet sensor</legend>"));
   rawData(F("<form action='"));
-  rawData(actionURL);
+  printWateringUrl(wsIndex);
   rawData(F("' method='post'>"));
 
   rawData(F("<table class='grab'>"));
@@ -1203,7 +1320,7 @@ void WebServerClass::sendWateringOptionsPage(const String& url, byte wsIndex) {
   rawData(F("<fieldset><legend>Watering pump</legend>"));
 
   rawData(F("<form action='"));
-  rawData(actionURL);
+  printWateringUrl(wsIndex);
   rawData(F("' method='post'>"));
 
   rawData(F("<table class='grab'>"));
@@ -1230,7 +1347,7 @@ void WebServerClass::sendWateringOptionsPage(const String& url, byte wsIndex) {
 //                        HARDWARE PAGES                           //
 /////////////////////////////////////////////////////////////////////
 
-void WebServerClass::sendHardwareOptionsPage(const String& getParams) {
+void WebServerClass::sendHardwareOptionsPage() {
 
   rawData(F("<fieldset><legend>Internal hardware</legend>"));
 
@@ -1318,7 +1435,41 @@ void WebServerClass::sendHardwareOptionsPage(const String& getParams) {
   rawData(F("</fieldset>"));
 }
 
-void WebServerClass::sendOtherOptionsPage(const String& getParams) {
+void WebServerClass::sendOtherOptionsPage_StorageStatisticsRow(const __FlashStringHelper* description, unsigned long value, const __FlashStringHelper* units) {
+  rawData(F("<tr><td>"));
+  rawData(description);
+  rawData(F("</td><td>"));
+  rawData(value, true);
+  rawData(units);
+  rawData(F("</td></tr>"));
+}
+
+void WebServerClass::sendOtherOptionsPage_StorageStatistics() {
+  const StorageStatistics& statistics = GB_StorageHelper.getStorageStatistics();
+
+  rawData(F("<tr><td colspan ='2'><b>Storage performance</b></td></tr>"));
+  sendOtherOptionsPage_StorageStatisticsRow(F("Boot record load"), statistics.bootRecordLoadTime, F(" us"));
+  sendOtherOptionsPage_StorageStatisticsRow(F("Log head restore"), statistics.logHeadRestoreTime, F(" us"));
+  sendOtherOptionsPage_StorageStatisticsRow(F("Log records stored since startup"), statistics.logStoredRecordsCount, F(""));
+  if (statistics.logStoredRecordsCount > 0) {
+    sendOtherOptionsPage_StorageStatisticsRow(F("Log record store"), statistics.logStoreTime / statistics.logStoredRecordsCount, F(" us"));
+    sendOtherOptionsPage_StorageStatisticsRow(F("Log bytes written per record"), statistics.logWrittenBytesCount / statistics.logStoredRecordsCount, F(""));
+  }
+  if (statistics.logScanTime > 0) {
+    sendOtherOptionsPage_StorageStatisticsRow(F("Full log scan"), statistics.logScanTime, F(" us"));
+    sendOtherOptionsPage_StorageStatisticsRow(F("Log records scanned"), statistics.logScannedRecordsCount, F(""));
+  }
+  rawData(F("<tr><td colspan ='2'>"));
+  rawData(F("<form action='"));
+  rawData(FS(S_URL_OTHER_PAGE));
+  rawData(F("' method='post'>"));
+  rawData(F("<input type='hidden' name='measureLogScan'/><input type='submit' value='Measure full log scan'>"));
+  rawData(F("</form>"));
+  rawData(F("</td></tr>"));
+  rawData(F("<tr><td colspan ='2'><br/></td></tr>"));
+}
+
+void WebServerClass::sendOtherOptionsPage() {
   //rawData(F("<fieldset><legend>Other</legend>"));  
   rawData(F("<table style='vertical-align:top; border-spacing:0px;'>"));
 
@@ -1346,6 +1497,9 @@ void WebServerClass::sendOtherOptionsPage(const String& getParams) {
 
   rawData(F("<tr><td colspan ='2'><br/></td></tr>"));
 
+  sendOtherOptionsPage_StorageStatistics();
+  rawData(F("<tr><td colspan ='2'><br/></td></tr>"));
+
   rawData(F("<tr><td>"));
   rawData(F("<form action='"));
   rawData(FS(S_URL_STATUS));
@@ -1370,22 +1524,24 @@ void WebServerClass::sendOtherOptionsPage(const String& getParams) {
   //rawData(F("</fieldset>"));
 }
 
-void WebServerClass::sendStorageDumpPage(const String& getParams, boolean isInternal) {
+void WebServerClass::sendStorageDumpPage(boolean isInternal) {
 
-  String paramValue;
+  const char* paramValue;
   byte rangeStart = 0x0; //0x[0]00
   byte rangeEnd = 0x0;   //0x[0]FF
   byte temp;
-  if (searchHttpParamByName(getParams, F("rangeStart"), paramValue)) {
-    if (paramValue.length() == 1) {
+  paramValue = getHttpParam(F("rangeStart"));
+  if (paramValue != NULL) {
+    if (strlen(paramValue) == 1) {
       temp = StringUtils::hexCharToByte(paramValue[0]);
       if (temp != 0xFF) {
         rangeStart = temp;
       }
     }
   }
-  if (searchHttpParamByName(getParams, F("rangeEnd"), paramValue)) {
-    if (paramValue.length() == 1) {
+  paramValue = getHttpParam(F("rangeEnd"));
+  if (paramValue != NULL) {
+    if (strlen(paramValue) == 1) {
       temp = StringUtils::hexCharToByte(paramValue[0]);
       if (temp != 0xFF) {
         rangeEnd = temp;
@@ -1407,22 +1563,23 @@ void WebServerClass::sendStorageDumpPage(const String& getParams, boolean isInte
   rawData(F("Address from "));
   rawData(F("<select id='rangeStartCombobox' name='rangeStart'>"));
 
-  String stringValue;
   for (byte counter = 0; counter < 0x10; counter++) {
-    stringValue = StringUtils::byteToHexString(counter, true);
-    stringValue += '0';
-    stringValue += '0';
-    tagOption(String(counter, HEX), stringValue, rangeStart == counter);
+    tagOptionBegin(counter, HEX, rangeStart == counter);
+    tagOptionText();
+    PrintUtils::printHexByte(*this, counter, true);
+    rawData(F("00"));
+    tagOptionEnd();
   }
   rawData(F("</select>"));
   rawData(F(" to "));
   rawData(F("<select id='rangeEndCombobox' name='rangeEnd'>"));
 
   for (byte counter = 0; counter < 0x10; counter++) {
-    stringValue = StringUtils::byteToHexString(counter, true);
-    stringValue += 'F';
-    stringValue += 'F';
-    tagOption(String(counter, HEX), stringValue, rangeEnd == counter);
+    tagOptionBegin(counter, HEX, rangeEnd == counter);
+    tagOptionText();
+    PrintUtils::printHexByte(*this, counter, true);
+    rawData(F("FF"));
+    tagOptionEnd();
   }
   rawData(F("</select>"));
   rawData(F("<input type='submit' value='Show'/>"));
@@ -1436,15 +1593,14 @@ void WebServerClass::sendStorageDumpPage(const String& getParams, boolean isInte
   rawData(F("<table class='grab align_center'><tr><th/>"));
   for (word i = 0; i < 0x10; i++) {
     rawData(F("<th>"));
-    String colName(i, HEX);
-    colName.toUpperCase();
-    rawData(colName);
+    print(i, HEX);
     rawData(F("</th>"));
   }
   rawData(F("</tr>"));
 
   word realRangeStart = ((word)(rangeStart) << 8);
   word realRangeEnd = ((word)(rangeEnd) << 8) + 0xFF;
+  byte rowBuffer[0x10]; // table row is read in bulk
   byte value;
   for (word i = realRangeStart;
       i <= realRangeEnd/*EEPROM_AT24C32.getCapacity()*/; i++) {
@@ -1452,23 +1608,26 @@ void WebServerClass::sendStorageDumpPage(const String& getParams, boolean isInte
     if (c_isWifiResponseError)
       return;
 
-    if (isInternal) {
-      value = EEPROM.read(i);
-    }
-    else {
-      value = EEPROM_AT24C32.read(i);
+    if (i % 16 == 0) {
+      if (isInternal) {
+        EEPROM.readBlock<byte>(i, rowBuffer, sizeof(rowBuffer));
+      }
+      else {
+        EEPROM_AT24C32.readBlock<byte>(i, rowBuffer, sizeof(rowBuffer));
+      }
     }
+    value = rowBuffer[i % 16];
 
     if (i % 16 == 0) {
       if (i > 0) {
         rawData(F("</tr>"));
       }
       rawData(F("<tr><td><b>"));
-      rawData(StringUtils::byteToHexString(i / 16));
+      PrintUtils::printHexByte(*this, i / 16);
       rawData(F("</b></td>"));
     }
     rawData(F("<td>"));
-    rawData(StringUtils::byteToHexString(value));
+    PrintUtils::printHexByte(*this, value);
     rawData(F("</td>"));
 
   }
@@ -1533,486 +1692,607 @@ void WebServerClass::sendPinMapPage(){
 //                          POST HANDLING                          //
 /////////////////////////////////////////////////////////////////////
 
-String WebServerClass::applyPostParams(const String& url, const String& postParams) {
-  //String queryStr;
-  word index = 0;
-  String name, value;
-  while (getHttpParamByIndex(postParams, index, name, value)) {
-    //if (queryStr.length() > 0){
-    //  queryStr += '&';
-    //}
-    //queryStr += name;
-    //queryStr += '=';   
-    //queryStr += applyPostParam(name, value);
+// Names of form fields, table is sorted by name
+const char S_POST_FIELD_AUTO_ADJUST_TIME_STAMP_DELTA[] PROGMEM = "autoAdjustTimeStampDelta";
+const char S_POST_FIELD_CLEAR_LAST_WATERING_TIME[] PROGMEM = "clearLastWateringTime";
+const char S_POST_FIELD_CRIT_TEMP_MAX[] PROGMEM = "critTempMax";
+const char S_POST_FIELD_CRIT_TEMP_MIN[] PROGMEM = "critTempMin";
+const char S_POST_FIELD_DAY_COLD_RATIO[] PROGMEM = "dayColdRatio";
+const char S_POST_FIELD_DAY_COLD_SPEED[] PROGMEM = "dayColdSpeed";
+const char S_POST_FIELD_DAY_HOT_RATIO[] PROGMEM = "dayHotRatio";
+const char S_POST_FIELD_DAY_HOT_SPEED[] PROGMEM = "dayHotSpeed";
+const char S_POST_FIELD_DAY_NORMAL_RATIO[] PROGMEM = "dayNormalRatio";
+const char S_POST_FIELD_DAY_NORMAL_SPEED[] PROGMEM = "dayNormalSpeed";
+const char S_POST_FIELD_DRY_VALUE[] PROGMEM = "dryValue";
+const char S_POST_FIELD_DRY_WATERING_DURATION[] PROGMEM = "dryWateringDuration";
+const char S_POST_FIELD_IN_AIR_VALUE[] PROGMEM = "inAirValue";
+const char S_POST_FIELD_IS_EEPROM_AT24C32_CONNECTED[] PROGMEM = "isEEPROM_AT24C32_Connected";
+const char S_POST_FIELD_IS_STORE_LOG_RECORDS_ENABLED[] PROGMEM = "isStoreLogRecordsEnabled";
+const char S_POST_FIELD_IS_WATER_PUMP_CONNECTED[] PROGMEM = "isWaterPumpConnected";
+const char S_POST_FIELD_IS_WET_SENSOR_CONNECTED[] PROGMEM = "isWetSensorConnected";
+const char S_POST_FIELD_IS_WIFI_STATION_MODE[] PROGMEM = "isWifiStationMode";
+const char S_POST_FIELD_MEASURE_LOG_SCAN[] PROGMEM = "measureLogScan";
+const char S_POST_FIELD_NIGHT_COLD_RATIO[] PROGMEM = "nightColdRatio";
+const char S_POST_FIELD_NIGHT_COLD_SPEED[] PROGMEM = "nightColdSpeed";
+const char S_POST_FIELD_NIGHT_HOT_RATIO[] PROGMEM = "nightHotRatio";
+const char S_POST_FIELD_NIGHT_HOT_SPEED[] PROGMEM = "nightHotSpeed";
+const char S_POST_FIELD_NIGHT_NORMAL_RATIO[] PROGMEM = "nightNormalRatio";
+const char S_POST_FIELD_NIGHT_NORMAL_SPEED[] PROGMEM = "nightNormalSpeed";
+const char S_POST_FIELD_NORMAL_VALUE[] PROGMEM = "normalValue";
+const char S_POST_FIELD_REBOOT_CONTROLLER[] PROGMEM = "rebootController";
+const char S_POST_FIELD_RESET_FIRMWARE[] PROGMEM = "resetFirmware";
+const char S_POST_FIELD_RESET_STORED_LOG[] PROGMEM = "resetStoredLog";
+const char S_POST_FIELD_RUN_DRY_WATERING_NOW[] PROGMEM = "runDryWateringNow";
+const char S_POST_FIELD_SET_CLOCK_TIME[] PROGMEM = "setClockTime";
+const char S_POST_FIELD_SKIP_NEXT_WATERING[] PROGMEM = "skipNextWatering";
+const char S_POST_FIELD_START_WATERING_AT[] PROGMEM = "startWateringAt";
+const char S_POST_FIELD_TEMP_DAY_MAX[] PROGMEM = "tempDayMax";
+const char S_POST_FIELD_TEMP_DAY_MIN[] PROGMEM = "tempDayMin";
+const char S_POST_FIELD_TEMP_NIGHT_MAX[] PROGMEM = "tempNightMax";
+const char S_POST_FIELD_TEMP_NIGHT_MIN[] PROGMEM = "tempNightMin";
+const char S_POST_FIELD_TURN_TO_DAY_MODE_AT[] PROGMEM = "turnToDayModeAt";
+const char S_POST_FIELD_TURN_TO_NIGHT_MODE_AT[] PROGMEM = "turnToNightModeAt";
+const char S_POST_FIELD_USE_FAN[] PROGMEM = "useFan";
+const char S_POST_FIELD_USE_HEATER[] PROGMEM = "useHeater";
+const char S_POST_FIELD_USE_LIGHT[] PROGMEM = "useLight";
+const char S_POST_FIELD_USE_RTC[] PROGMEM = "useRTC";
+const char S_POST_FIELD_USE_THERMOMETER[] PROGMEM = "useThermometer";
+const char S_POST_FIELD_USE_WET_SENSOR_FOR_WATERING[] PROGMEM = "useWetSensorForWatering";
+const char S_POST_FIELD_VERY_DRY_VALUE[] PROGMEM = "veryDryValue";
+const char S_POST_FIELD_VERY_DRY_WATERING_DURATION[] PROGMEM = "veryDryWateringDuration";
+const char S_POST_FIELD_VERY_WET_VALUE[] PROGMEM = "veryWetValue";
+const char S_POST_FIELD_WET_VALUE[] PROGMEM = "wetValue";
+const char S_POST_FIELD_WIFI_PASS[] PROGMEM = "wifiPass";
+const char S_POST_FIELD_WIFI_SSID[] PROGMEM = "wifiSSID";
+
+const ProgMemRoute POST_FIELD_ROUTES[] PROGMEM = {
+  {S_POST_FIELD_AUTO_ADJUST_TIME_STAMP_DELTA, POST_FIELD_AUTO_ADJUST_TIME_STAMP_DELTA},
+  {S_POST_FIELD_CLEAR_LAST_WATERING_TIME, POST_FIELD_CLEAR_LAST_WATERING_TIME},
+  {S_POST_FIELD_CRIT_TEMP_MAX, POST_FIELD_CRIT_TEMP_MAX},
+  {S_POST_FIELD_CRIT_TEMP_MIN, POST_FIELD_CRIT_TEMP_MIN},
+  {S_POST_FIELD_DAY_COLD_RATIO, POST_FIELD_DAY_COLD_RATIO},
+  {S_POST_FIELD_DAY_COLD_SPEED, POST_FIELD_DAY_COLD_SPEED},
+  {S_POST_FIELD_DAY_HOT_RATIO, POST_FIELD_DAY_HOT_RATIO},
+  {S_POST_FIELD_DAY_HOT_SPEED, POST_FIELD_DAY_HOT_SPEED},
+  {S_POST_FIELD_DAY_NORMAL_RATIO, POST_FIELD_DAY_NORMAL_RATIO},
+  {S_POST_FIELD_DAY_NORMAL_SPEED, POST_FIELD_DAY_NORMAL_SPEED},
+  {S_POST_FIELD_DRY_VALUE, POST_FIELD_DRY_VALUE},
+  {S_POST_FIELD_DRY_WATERING_DURATION, POST_FIELD_DRY_WATERING_DURATION},
+  {S_POST_FIELD_IN_AIR_VALUE, POST_FIELD_IN_AIR_VALUE},
+  {S_POST_FIELD_IS_EEPROM_AT24C32_CONNECTED, POST_FIELD_IS_EEPROM_AT24C32_CONNECTED},
+  {S_POST_FIELD_IS_STORE_LOG_RECORDS_ENABLED, POST_FIELD_IS_STORE_LOG_RECORDS_ENABLED},
+  {S_POST_FIELD_IS_WATER_PUMP_CONNECTED, POST_FIELD_IS_WATER_PUMP_CONNECTED},
+  {S_POST_FIELD_IS_WET_SENSOR_CONNECTED, POST_FIELD_IS_WET_SENSOR_CONNECTED},
+  {S_POST_FIELD_IS_WIFI_STATION_MODE, POST_FIELD_IS_WIFI_STATION_MODE},
+  {S_POST_FIELD_MEASURE_LOG_SCAN, POST_FIELD_MEASURE_LOG_SCAN},
+  {S_POST_FIELD_NIGHT_COLD_RATIO, POST_FIELD_NIGHT_COLD_RATIO},
+  {S_POST_FIELD_NIGHT_COLD_SPEED, POST_FIELD_NIGHT_COLD_SPEED},
+  {S_POST_FIELD_NIGHT_HOT_RATIO, POST_FIELD_NIGHT_HOT_RATIO},
+  {S_POST_FIELD_NIGHT_HOT_SPEED, POST_FIELD_NIGHT_HOT_SPEED},
+  {S_POST_FIELD_NIGHT_NORMAL_RATIO, POST_FIELD_NIGHT_NORMAL_RATIO},
+  {S_POST_FIELD_NIGHT_NORMAL_SPEED, POST_FIELD_NIGHT_NORMAL_SPEED},
+  {S_POST_FIELD_NORMAL_VALUE, POST_FIELD_NORMAL_VALUE},
+  {S_POST_FIELD_REBOOT_CONTROLLER, POST_FIELD_REBOOT_CONTROLLER},
+  {S_POST_FIELD_RESET_FIRMWARE, POST_FIELD_RESET_FIRMWARE},
+  {S_POST_FIELD_RESET_STORED_LOG, POST_FIELD_RESET_STORED_LOG},
+  {S_POST_FIELD_RUN_DRY_WATERING_NOW, POST_FIELD_RUN_DRY_WATERING_NOW},
+  {S_POST_FIELD_SET_CLOCK_TIME, POST_FIELD_SET_CLOCK_TIME},
+  {S_POST_FIELD_SKIP_NEXT_WATERING, POST_FIELD_SKIP_NEXT_WATERING},
+  {S_POST_FIELD_START_WATERING_AT, POST_FIELD_START_WATERING_AT},
+  {S_POST_FIELD_TEMP_DAY_MAX, POST_FIELD_TEMP_DAY_MAX},
+  {S_POST_FIELD_TEMP_DAY_MIN, POST_FIELD_TEMP_DAY_MIN},
+  {S_POST_FIELD_TEMP_NIGHT_MAX, POST_FIELD_TEMP_NIGHT_MAX},
+  {S_POST_FIELD_TEMP_NIGHT_MIN, POST_FIELD_TEMP_NIGHT_MIN},
+  {S_POST_FIELD_TURN_TO_DAY_MODE_AT, POST_FIELD_TURN_TO_DAY_MODE_AT},
+  {S_POST_FIELD_TURN_TO_NIGHT_MODE_AT, POST_FIELD_TURN_TO_NIGHT_MODE_AT},
+  {S_POST_FIELD_USE_FAN, POST_FIELD_USE_FAN},
+  {S_POST_FIELD_USE_HEATER, POST_FIELD_USE_HEATER},
+  {S_POST_FIELD_USE_LIGHT, POST_FIELD_USE_LIGHT},
+  {S_POST_FIELD_USE_RTC, POST_FIELD_USE_RTC},
+  {S_POST_FIELD_USE_THERMOMETER, POST_FIELD_USE_THERMOMETER},
+  {S_POST_FIELD_USE_WET_SENSOR_FOR_WATERING, POST_FIELD_USE_WET_SENSOR_FOR_WATERING},
+  {S_POST_FIELD_VERY_DRY_VALUE, POST_FIELD_VERY_DRY_VALUE},
+  {S_POST_FIELD_VERY_DRY_WATERING_DURATION, POST_FIELD_VERY_DRY_WATERING_DURATION},
+  {S_POST_FIELD_VERY_WET_VALUE, POST_FIELD_VERY_WET_VALUE},
+  {S_POST_FIELD_WET_VALUE, POST_FIELD_WET_VALUE},
+  {S_POST_FIELD_WIFI_PASS, POST_FIELD_WIFI_PASS},
+  {S_POST_FIELD_WIFI_SSID, POST_FIELD_WIFI_SSID}
+};
+
+byte WebServerClass::findPostField(const char* name) {
+  return findProgMemRoute(POST_FIELD_ROUTES, sizeof(POST_FIELD_ROUTES) / sizeof(ProgMemRoute), name, POST_FIELD_UNKNOWN);
+}
+
+const char* WebServerClass::applyPostParams(const char* url, char* postParams) {
+  parseHttpParams(postParams);
+  for (byte i = 0; i < c_httpParamsCount; i++) {
+    const HttpParam& param = c_httpParams[i];
 
-    boolean result = applyPostParam(url, name, value);
+    boolean result = applyPostParam(url, param.name, param.value);
 
     if (g_useSerialMonitor) {
       showWebMessage(F("Execute ["), false);
-      Serial.print(name);
+      Serial.print(param.name);
       Serial.print('=');
-      Serial.print(value);
+      Serial.print(param.value);
       Serial.print(F("] - "));
       Serial.println(result ? F("OK") : F("FAIL"));
     }
-
-    index++;
   }
-  //if (index > 0){
-  //  return url + String('?') + queryStr;
-  //}
-  //else {
   return url;
-  //}
 }
 
-boolean WebServerClass::applyPostParam(const String& url, const String& name, const String& value) {
-
-  if (StringUtils::flashStringEquals(name, F("isWifiStationMode"))) {
-    if (value.length() != 1) {
-      return false;
-    }
-    GB_StorageHelper.setWifiStationMode(value[0] == '1');
+boolean WebServerClass::applyPostParam(const char* url, const char* name, const char* value) {
 
-  }
-  else if (StringUtils::flashStringEquals(name, F("wifiSSID"))) {
-    GB_StorageHelper.setWifiSSID(value);
-
-  }
-  else if (StringUtils::flashStringEquals(name, F("wifiPass"))) {
-    GB_StorageHelper.setWifiPass(value);
+  byte field = findPostField(name);
 
-  }
-  else if (StringUtils::flashStringEquals(name, F("resetStoredLog"))) {
-    GB_StorageHelper.resetStoredLog();
-  }
-  else if (StringUtils::flashStringEquals(name, F("isStoreLogRecordsEnabled"))) {
-    if (value.length() != 1) {
-      return false;
-    }
-    GB_StorageHelper.setStoreLogRecordsEnabled(value[0] == '1');
-  }
-  else if (StringUtils::flashStringEquals(name, F("rebootController"))) {
-    GB_Controller.rebootController();
-  }
-  else if (StringUtils::flashStringEquals(name, F("resetFirmware"))) {
-    GB_StorageHelper.resetFirmware();
-    GB_Controller.rebootController();
-  }
-
-  else if (StringUtils::flashStringEquals(name, F("turnToDayModeAt")) ||
-      StringUtils::flashStringEquals(name, F("turnToNightModeAt"))) {
-    word timeValue = getTimeFromInput(value);
-    if (timeValue == 0xFFFF) {
-      return false;
-    }
-
-    if (StringUtils::flashStringEquals(name, F("turnToDayModeAt"))) {
-      GB_StorageHelper.setTurnToDayModeTime(timeValue / 60, timeValue % 60);
-    }
-    else if (StringUtils::flashStringEquals(name, F("turnToNightModeAt"))) {
-      GB_StorageHelper.setTurnToNightModeTime(timeValue / 60, timeValue % 60);
-    }
-    c_isWifiForceUpdateGrowboxState = true;
-  }
-  else if (StringUtils::flashStringEquals(name, F("tempDayMin")) ||
-      StringUtils::flashStringEquals(name, F("tempDayMax")) ||
-      StringUtils::flashStringEquals(name, F("tempNightMin")) ||
-      StringUtils::flashStringEquals(name, F("tempNightMax")) ||
-      StringUtils::flashStringEquals(name, F("critTempMin")) ||
-      StringUtils::flashStringEquals(name, F("critTempMax"))) {
-    byte temp = value.toInt();
-    if (temp == 0) {
-      return false;
-    }
-
-    if (StringUtils::flashStringEquals(name, F("tempDayMin"))) {
-      GB_StorageHelper.setNormalTemperatueDayMin(temp);
-    }
-    else if (StringUtils::flashStringEquals(name, F("tempDayMax"))) {
-      GB_StorageHelper.setNormalTemperatueDayMax(temp);
-    }
-    else if (StringUtils::flashStringEquals(name, F("tempNightMin"))) {
-      GB_StorageHelper.setNormalTemperatueNightMin(temp);
+  switch (field) {
+    case POST_FIELD_IS_WIFI_STATION_MODE: {
+      if (strlen(value) != 1) {
+        return false;
+      }
+      GB_StorageHelper.setWifiStationMode(value[0] == '1');
+      break;
     }
-    else if (StringUtils::flashStringEquals(name, F("tempNightMax"))) {
-      GB_StorageHelper.setNormalTemperatueNightMax(temp);
+    case POST_FIELD_WIFI_SSID: {
+      GB_StorageHelper.setWifiSSID(value);
+      break;
     }
-    else if (StringUtils::flashStringEquals(name, F("critTempMin"))) {
-      GB_StorageHelper.setCriticalTemperatueMin(temp);
+    case POST_FIELD_WIFI_PASS: {
+      GB_StorageHelper.setWifiPass(value);
+      break;
     }
-    else if (StringUtils::flashStringEquals(name, F("critTempMax"))) {
-      GB_StorageHelper.setCriticalTemperatueMax(temp);
+    case POST_FIELD_RESET_STORED_LOG: {
+      GB_StorageHelper.resetStoredLog();
+      break;
     }
+    case POST_FIELD_IS_STORE_LOG_RECORDS_ENABLED: {
+      if (strlen(value) != 1) {
+        return false;
+      }
+      GB_StorageHelper.setStoreLogRecordsEnabled(value[0] == '1');
+      break;
+    }
+    case POST_FIELD_REBOOT_CONTROLLER: {
+      GB_Controller.rebootController();
+      break;
+    }
+    case POST_FIELD_RESET_FIRMWARE: {
+      GB_StorageHelper.resetFirmware();
+      GB_Controller.rebootController();
+      break;
+    }
+    case POST_FIELD_MEASURE_LOG_SCAN: {
+      GB_StorageHelper.measureLogScanTime();
+      break;
+    }
+    case POST_FIELD_TURN_TO_DAY_MODE_AT:
+    case POST_FIELD_TURN_TO_NIGHT_MODE_AT: {
+      word timeValue = getTimeFromInput(value);
+      if (timeValue == 0xFFFF) {
+        return false;
+      }
 
-    c_isWifiForceUpdateGrowboxState = true;
-  }
-  else if (StringUtils::flashStringEquals(name, F("isWetSensorConnected")) ||
-      StringUtils::flashStringEquals(name, F("isWaterPumpConnected")) ||
-      StringUtils::flashStringEquals(name, F("useWetSensorForWatering")) ||
-      StringUtils::flashStringEquals(name, F("skipNextWatering"))) {
-
-    byte wsIndex = getWateringIndexFromUrl(url);
-    if (wsIndex == 0xFF) {
-      return false;
-    }
-    if (value.length() != 1) {
-      return false;
-    }
-    boolean boolValue = (value[0] == '1');
+      if (field == POST_FIELD_TURN_TO_DAY_MODE_AT) {
+        GB_StorageHelper.setTurnToDayModeTime(timeValue / 60, timeValue % 60);
+      }
+      else if (field == POST_FIELD_TURN_TO_NIGHT_MODE_AT) {
+        GB_StorageHelper.setTurnToNightModeTime(timeValue / 60, timeValue % 60);
+      }
+      c_isWifiForceUpdateGrowboxState = true;
+      break;
+    }
+    case POST_FIELD_TEMP_DAY_MIN:
+    case POST_FIELD_TEMP_DAY_MAX:
+    case POST_FIELD_TEMP_NIGHT_MIN:
+    case POST_FIELD_TEMP_NIGHT_MAX:
+    case POST_FIELD_CRIT_TEMP_MIN:
+    case POST_FIELD_CRIT_TEMP_MAX: {
+      byte temp = atoi(value);
+      if (temp == 0) {
+        return false;
+      }
 
-    BootRecord::WateringSystemPreferencies wsp = GB_StorageHelper.getWateringSystemPreferenciesById(wsIndex);
-    if (StringUtils::flashStringEquals(name, F("isWetSensorConnected"))) {
-      wsp.boolPreferencies.isWetSensorConnected = boolValue;
-    }
-    else if (StringUtils::flashStringEquals(name, F("isWaterPumpConnected"))) {
-      wsp.boolPreferencies.isWaterPumpConnected = boolValue;
-      wsp.lastWateringTimeStamp = 0;
-    }
-    else if (StringUtils::flashStringEquals(name, F("useWetSensorForWatering"))) {
-      wsp.boolPreferencies.useWetSensorForWatering = boolValue;
-    }
-    else if (StringUtils::flashStringEquals(name, F("skipNextWatering"))) {
-      wsp.boolPreferencies.skipNextWatering = boolValue;
-    }
-    GB_StorageHelper.setWateringSystemPreferenciesById(wsIndex, wsp);
+      if (field == POST_FIELD_TEMP_DAY_MIN) {
+        GB_StorageHelper.setNormalTemperatueDayMin(temp);
+      }
+      else if (field == POST_FIELD_TEMP_DAY_MAX) {
+        GB_StorageHelper.setNormalTemperatueDayMax(temp);
+      }
+      else if (field == POST_FIELD_TEMP_NIGHT_MIN) {
+        GB_StorageHelper.setNormalTemperatueNightMin(temp);
+      }
+      else if (field == POST_FIELD_TEMP_NIGHT_MAX) {
+        GB_StorageHelper.setNormalTemperatueNightMax(temp);
+      }
+      else if (field == POST_FIELD_CRIT_TEMP_MIN) {
+        GB_StorageHelper.setCriticalTemperatueMin(temp);
+      }
+      else if (field == POST_FIELD_CRIT_TEMP_MAX) {
+        GB_StorageHelper.setCriticalTemperatueMax(temp);
+      }
 
-    if (StringUtils::flashStringEquals(name, F("isWaterPumpConnected"))) {
-      GB_Watering.updateWateringSchedule();
+      c_isWifiForceUpdateGrowboxState = true;
+      break;
     }
-  }
-  else if (StringUtils::flashStringEquals(name, F("inAirValue")) ||
-      StringUtils::flashStringEquals(name, F("veryDryValue")) ||
-      StringUtils::flashStringEquals(name, F("dryValue")) ||
-      StringUtils::flashStringEquals(name, F("normalValue")) ||
-      StringUtils::flashStringEquals(name, F("wetValue")) ||
-      StringUtils::flashStringEquals(name, F("veryWetValue"))) {
+    case POST_FIELD_IS_WET_SENSOR_CONNECTED:
+    case POST_FIELD_IS_WATER_PUMP_CONNECTED:
+    case POST_FIELD_USE_WET_SENSOR_FOR_WATERING:
+    case POST_FIELD_SKIP_NEXT_WATERING: {
+      byte wsIndex = getWateringIndexFromUrl(url);
+      if (wsIndex == 0xFF) {
+        return false;
+      }
+      if (strlen(value) != 1) {
+        return false;
+      }
+      boolean boolValue = (value[0] == '1');
 
-    byte wsIndex = getWateringIndexFromUrl(url);
-    if (wsIndex == 0xFF) {
-      return false;
-    }
-    byte intValue = value.toInt();
-    if (intValue == 0) {
-      return false;
-    }
+      BootRecord::WateringSystemPreferencies wsp = GB_StorageHelper.getWateringSystemPreferenciesById(wsIndex);
+      if (field == POST_FIELD_IS_WET_SENSOR_CONNECTED) {
+        wsp.boolPreferencies.isWetSensorConnected = boolValue;
+      }
+      else if (field == POST_FIELD_IS_WATER_PUMP_CONNECTED) {
+        wsp.boolPreferencies.isWaterPumpConnected = boolValue;
+        wsp.lastWateringTimeStamp = 0;
+      }
+      else if (field == POST_FIELD_USE_WET_SENSOR_FOR_WATERING) {
+        wsp.boolPreferencies.useWetSensorForWatering = boolValue;
+      }
+      else if (field == POST_FIELD_SKIP_NEXT_WATERING) {
+        wsp.boolPreferencies.skipNextWatering = boolValue;
+      }
+      GB_StorageHelper.setWateringSystemPreferenciesById(wsIndex, wsp);
 
-    BootRecord::WateringSystemPreferencies wsp = GB_StorageHelper.getWateringSystemPreferenciesById(wsIndex);
-    if (StringUtils::flashStringEquals(name, F("inAirValue"))) {
-      wsp.inAirValue = intValue;
-    }
-    else if (StringUtils::flashStringEquals(name, F("veryDryValue"))) {
-      wsp.veryDryValue = intValue;
-    }
-    else if (StringUtils::flashStringEquals(name, F("dryValue"))) {
-      wsp.dryValue = intValue;
-    }
-    else if (StringUtils::flashStringEquals(name, F("normalValue"))) {
-      wsp.normalValue = intValue;
-    }
-    else if (StringUtils::flashStringEquals(name, F("wetValue"))) {
-      wsp.wetValue = intValue;
-    }
-    else if (StringUtils::flashStringEquals(name, F("veryWetValue"))) {
-      wsp.veryWetValue = intValue;
-    }
-    GB_StorageHelper.setWateringSystemPreferenciesById(wsIndex, wsp);
-  }
-  else if (StringUtils::flashStringEquals(name, F("dryWateringDuration")) ||
-      StringUtils::flashStringEquals(name, F("veryDryWateringDuration"))) {
+      if (field == POST_FIELD_IS_WATER_PUMP_CONNECTED) {
+        GB_Watering.updateWateringSchedule();
+      }
+      break;
+    }
+    case POST_FIELD_IN_AIR_VALUE:
+    case POST_FIELD_VERY_DRY_VALUE:
+    case POST_FIELD_DRY_VALUE:
+    case POST_FIELD_NORMAL_VALUE:
+    case POST_FIELD_WET_VALUE:
+    case POST_FIELD_VERY_WET_VALUE: {
+      byte wsIndex = getWateringIndexFromUrl(url);
+      if (wsIndex == 0xFF) {
+        return false;
+      }
+      byte intValue = atoi(value);
+      if (intValue == 0) {
+        return false;
+      }
 
-    byte wsIndex = getWateringIndexFromUrl(url);
-    if (wsIndex == 0xFF) {
-      return false;
-    }
-    byte intValue = value.toInt();
-    if (intValue == 0) {
-      return false;
-    }
+      BootRecord::WateringSystemPreferencies wsp = GB_StorageHelper.getWateringSystemPreferenciesById(wsIndex);
+      if (field == POST_FIELD_IN_AIR_VALUE) {
+        wsp.inAirValue = intValue;
+      }
+      else if (field == POST_FIELD_VERY_DRY_VALUE) {
+        wsp.veryDryValue = intValue;
+      }
+      else if (field == POST_FIELD_DRY_VALUE) {
+        wsp.dryValue = intValue;
+      }
+      else if (field == POST_FIELD_NORMAL_VALUE) {
+        wsp.normalValue = intValue;
+      }
+      else if (field == POST_FIELD_WET_VALUE) {
+        wsp.wetValue = intValue;
+      }
+      else if (field == POST_FIELD_VERY_WET_VALUE) {
+        wsp.veryWetValue = intValue;
+      }
+      GB_StorageHelper.setWateringSystemPreferenciesById(wsIndex, wsp);
+      break;
+    }
+    case POST_FIELD_DRY_WATERING_DURATION:
+    case POST_FIELD_VERY_DRY_WATERING_DURATION: {
+      byte wsIndex = getWateringIndexFromUrl(url);
+      if (wsIndex == 0xFF) {
+        return false;
+      }
+      byte intValue = atoi(value);
+      if (intValue == 0) {
+        return false;
+      }
 
-    BootRecord::WateringSystemPreferencies wsp = GB_StorageHelper.getWateringSystemPreferenciesById(wsIndex);
-    if (StringUtils::flashStringEquals(name, F("dryWateringDuration"))) {
-      wsp.dryWateringDuration = intValue;
-    }
-    else if (StringUtils::flashStringEquals(name, F("veryDryWateringDuration"))) {
-      wsp.veryDryWateringDuration = intValue;
-    }
-    GB_StorageHelper.setWateringSystemPreferenciesById(wsIndex, wsp);
-  }
-  else if (StringUtils::flashStringEquals(name, F("startWateringAt"))) {
-    byte wsIndex = getWateringIndexFromUrl(url);
-    if (wsIndex == 0xFF) {
-      return false;
-    }
-    word timeValue = getTimeFromInput(value);
-    if (timeValue == 0xFFFF) {
-      return false;
+      BootRecord::WateringSystemPreferencies wsp = GB_StorageHelper.getWateringSystemPreferenciesById(wsIndex);
+      if (field == POST_FIELD_DRY_WATERING_DURATION) {
+        wsp.dryWateringDuration = intValue;
+      }
+      else if (field == POST_FIELD_VERY_DRY_WATERING_DURATION) {
+        wsp.veryDryWateringDuration = intValue;
+      }
+      GB_StorageHelper.setWateringSystemPreferenciesById(wsIndex, wsp);
+      break;
     }
-    BootRecord::WateringSystemPreferencies wsp = GB_StorageHelper.getWateringSystemPreferenciesById(wsIndex);
-    wsp.startWateringAt = timeValue;
-    GB_StorageHelper.setWateringSystemPreferenciesById(wsIndex, wsp);
+    case POST_FIELD_START_WATERING_AT: {
+      byte wsIndex = getWateringIndexFromUrl(url);
+      if (wsIndex == 0xFF) {
+        return false;
+      }
+      word timeValue = getTimeFromInput(value);
+      if (timeValue == 0xFFFF) {
+        return false;
+      }
+      BootRecord::WateringSystemPreferencies wsp = GB_StorageHelper.getWateringSystemPreferenciesById(wsIndex);
+      wsp.startWateringAt = timeValue;
+      GB_StorageHelper.setWateringSystemPreferenciesById(wsIndex, wsp);
 
-    GB_Watering.updateWateringSchedule();
-  }
-  else if (StringUtils::flashStringEquals(name, F("runDryWateringNow"))) {
-    byte wsIndex = getWateringIndexFromUrl(url);
-    if (wsIndex == 0xFF) {
-      return false;
+      GB_Watering.updateWateringSchedule();
+      break;
     }
-    GB_Watering.turnOnWaterPumpManual(wsIndex);
-  }
-  else if (StringUtils::flashStringEquals(name, F("clearLastWateringTime"))) {
-    byte wsIndex = getWateringIndexFromUrl(url);
-    if (wsIndex == 0xFF) {
-      return false;
+    case POST_FIELD_RUN_DRY_WATERING_NOW: {
+      byte wsIndex = getWateringIndexFromUrl(url);
+      if (wsIndex == 0xFF) {
+        return false;
+      }
+      GB_Watering.turnOnWaterPumpManual(wsIndex);
+      break;
     }
-    GB_Watering.turnOnWaterPumpManual(wsIndex);
+    case POST_FIELD_CLEAR_LAST_WATERING_TIME: {
+      byte wsIndex = getWateringIndexFromUrl(url);
+      if (wsIndex == 0xFF) {
+        return false;
+      }
+      GB_Watering.turnOnWaterPumpManual(wsIndex);
 
-    BootRecord::WateringSystemPreferencies wsp = GB_StorageHelper.getWateringSystemPreferenciesById(wsIndex);
-    wsp.lastWateringTimeStamp = 0;
-    GB_StorageHelper.setWateringSystemPreferenciesById(wsIndex, wsp);
+      BootRecord::WateringSystemPreferencies wsp = GB_StorageHelper.getWateringSystemPreferenciesById(wsIndex);
+      wsp.lastWateringTimeStamp = 0;
+      GB_StorageHelper.setWateringSystemPreferenciesById(wsIndex, wsp);
 
-    GB_Watering.updateWateringSchedule();
-  }
-  else if (StringUtils::flashStringEquals(name, F("setClockTime"))) {
-    time_t newTimeStamp = strtoul(value.c_str(), NULL, 0);
-    if (newTimeStamp == 0) {
-      return false;
+      GB_Watering.updateWateringSchedule();
+      break;
     }
-    GB_Controller.setClockTime(newTimeStamp + WEB_SERVER_AVERAGE_PAGE_LOAD_TIME_SEC);
+    case POST_FIELD_SET_CLOCK_TIME: {
+      time_t newTimeStamp = strtoul(value, NULL, 0);
+      if (newTimeStamp == 0) {
+        return false;
+      }
+      GB_Controller.setClockTime(newTimeStamp + WEB_SERVER_AVERAGE_PAGE_LOAD_TIME_SEC);
 
-    c_isWifiForceUpdateGrowboxState = true; // Switch to Day/Night mode
-  }
-  else if (StringUtils::flashStringEquals(name, F("useRTC"))) {
-    if (value.length() != 1) {
-      return false;
+      c_isWifiForceUpdateGrowboxState = true; // Switch to Day/Night mode
+      break;
     }
-    boolean boolValue = (value[0] == '1');
-    GB_Controller.setUseRTC(boolValue);
+    case POST_FIELD_USE_RTC: {
+      if (strlen(value) != 1) {
+        return false;
+      }
+      boolean boolValue = (value[0] == '1');
+      GB_Controller.setUseRTC(boolValue);
 
-    c_isWifiForceUpdateGrowboxState = true; // Switch to Day/Night mode
-  }
-  else if (StringUtils::flashStringEquals(name, F("autoAdjustTimeStampDelta"))) {
-    if (value.length() == 0) {
-      return false;
+      c_isWifiForceUpdateGrowboxState = true; // Switch to Day/Night mode
+      break;
     }
-    boolean isZero = false;
-    if (value.length() == 1) {
-      if (value[0] == '0') {
-        isZero = true;
+    case POST_FIELD_AUTO_ADJUST_TIME_STAMP_DELTA: {
+      if (value[0] == 0x00) {
+        return false;
       }
+      boolean isZero = false;
+      if (strlen(value) == 1) {
+        if (value[0] == '0') {
+          isZero = true;
+        }
+      }
+      int16_t intValue = atoi(value);
+      if (intValue == 0 && !isZero) {
+        return false;
+      }
+      GB_Controller.setAutoAdjustClockTimeDelta(intValue);
+      break;
     }
-    int16_t intValue = value.toInt();
-    if (intValue == 0 && !isZero) {
-      return false;
-    }
-    GB_Controller.setAutoAdjustClockTimeDelta(intValue);
-  }
-  else if (StringUtils::flashStringEquals(name, F("isEEPROM_AT24C32_Connected"))) {
-    if (value.length() != 1) {
-      return false;
-    }
-    boolean boolValue = (value[0] == '1');
-    GB_StorageHelper.setUseExternal_EEPROM_AT24C32(boolValue);
-  }
-  else if (StringUtils::flashStringEquals(name, F("useThermometer"))) {
-    if (value.length() != 1) {
-      return false;
-    }
-    boolean boolValue = (value[0] == '1');
-    GB_Thermometer.setUseThermometer(boolValue);
-
-    c_isWifiForceUpdateGrowboxState = true;
-  }
-  else if (StringUtils::flashStringEquals(name, F("useLight"))) {
-    if (value.length() != 1) {
-      return false;
+    case POST_FIELD_IS_EEPROM_AT24C32_CONNECTED: {
+      if (strlen(value) != 1) {
+        return false;
+      }
+      boolean boolValue = (value[0] == '1');
+      GB_StorageHelper.setUseExternal_EEPROM_AT24C32(boolValue);
+      break;
     }
-    boolean boolValue = (value[0] == '1');
-    GB_Controller.setUseLight(boolValue);
+    case POST_FIELD_USE_THERMOMETER: {
+      if (strlen(value) != 1) {
+        return false;
+      }
+      boolean boolValue = (value[0] == '1');
+      GB_Thermometer.setUseThermometer(boolValue);
 
-    c_isWifiForceUpdateGrowboxState = true;
-  }
-  else if (StringUtils::flashStringEquals(name, F("useFan"))) {
-    if (value.length() != 1) {
-      return false;
+      c_isWifiForceUpdateGrowboxState = true;
+      break;
     }
-    boolean boolValue = (value[0] == '1');
-    GB_Controller.setUseFan(boolValue);
+    case POST_FIELD_USE_LIGHT: {
+      if (strlen(value) != 1) {
+        return false;
+      }
+      boolean boolValue = (value[0] == '1');
+      GB_Controller.setUseLight(boolValue);
 
-    c_isWifiForceUpdateGrowboxState = true;
-  }
-  else if (StringUtils::flashStringEquals(name, F("useHeater"))) {
-    if (value.length() != 1) {
-      return false;
-    }
-    boolean boolValue = (value[0] == '1');
-    GB_Controller.setUseHeater(boolValue);
-
-    c_isWifiForceUpdateGrowboxState = true;
-
-  }
-  else if (StringUtils::flashStringEquals(name, F("dayColdSpeed")) ||
-      StringUtils::flashStringEquals(name, F("dayNormalSpeed")) ||
-      StringUtils::flashStringEquals(name, F("dayHotSpeed")) ||
-      StringUtils::flashStringEquals(name, F("nightColdSpeed")) ||
-      StringUtils::flashStringEquals(name, F("nightNormalSpeed")) ||
-      StringUtils::flashStringEquals(name, F("nightHotSpeed"))) {
-    byte isOn, speed;
-    if (StringUtils::flashStringEquals(value, F("off"))) {
-      isOn = false;
-      speed = RELAY_OFF;  // Compiler warning
+      c_isWifiForceUpdateGrowboxState = true;
+      break;
     }
-    else if (StringUtils::flashStringEquals(value, F("low"))) {
-      isOn = true;
-      speed = FAN_SPEED_LOW;
-    }
-    else if (StringUtils::flashStringEquals(value, F("high"))) {
-      isOn = true;
-      speed = FAN_SPEED_HIGH;
-    }
-    else  {
-      return false;
-    }
-
-    byte fanSpeedValue;
-    byte fanSpeedDayColdTemperature, fanSpeedDayNormalTemperature, fanSpeedDayHotTemperature,
-         fanSpeedNightColdTemperature, fanSpeedNightNormalTemperature,fanSpeedNightHotTemperature;
-    GB_StorageHelper.getFanParameters(
-        fanSpeedDayColdTemperature, fanSpeedDayNormalTemperature, fanSpeedDayHotTemperature,
-        fanSpeedNightColdTemperature, fanSpeedNightNormalTemperature, fanSpeedNightHotTemperature);
+    case POST_FIELD_USE_FAN: {
+      if (strlen(value) != 1) {
+        return false;
+      }
+      boolean boolValue = (value[0] == '1');
+      GB_Controller.setUseFan(boolValue);
 
-    if (StringUtils::flashStringEquals(name, F("dayColdSpeed"))) {
-      fanSpeedValue = fanSpeedDayColdTemperature;
-    }
-    else if (StringUtils::flashStringEquals(name, F("dayNormalSpeed"))){
-      fanSpeedValue = fanSpeedDayNormalTemperature;
-    }
-    else if (StringUtils::flashStringEquals(name, F("dayHotSpeed"))){
-      fanSpeedValue = fanSpeedDayHotTemperature;
-    }
-    else if (StringUtils::flashStringEquals(name, F("nightColdSpeed"))){
-      fanSpeedValue = fanSpeedNightColdTemperature;
-    }
-    else if (StringUtils::flashStringEquals(name, F("nightNormalSpeed"))){
-      fanSpeedValue = fanSpeedNightNormalTemperature;
-    }
-    else if (StringUtils::flashStringEquals(name, F("nightHotSpeed"))){
-      fanSpeedValue = fanSpeedNightHotTemperature;
-    }
-    else {
-      return false;
+      c_isWifiForceUpdateGrowboxState = true;
+      break;
     }
+    case POST_FIELD_USE_HEATER: {
+      if (strlen(value) != 1) {
+        return false;
+      }
+      boolean boolValue = (value[0] == '1');
+      GB_Controller.setUseHeater(boolValue);
+
+      c_isWifiForceUpdateGrowboxState = true;
+      break;
+    }
+    case POST_FIELD_DAY_COLD_SPEED:
+    case POST_FIELD_DAY_NORMAL_SPEED:
+    case POST_FIELD_DAY_HOT_SPEED:
+    case POST_FIELD_NIGHT_COLD_SPEED:
+    case POST_FIELD_NIGHT_NORMAL_SPEED:
+    case POST_FIELD_NIGHT_HOT_SPEED: {
+      byte isOn, speed;
+      if (StringUtils::flashStringEquals(value, F("off"))) {
+        isOn = false;
+        speed = RELAY_OFF;  // Compiler warning
+      }
+      else if (StringUtils::flashStringEquals(value, F("low"))) {
+        isOn = true;
+        speed = FAN_SPEED_LOW;
+      }
+      else if (StringUtils::flashStringEquals(value, F("high"))) {
+        isOn = true;
+        speed = FAN_SPEED_HIGH;
+      }
+      else  {
+        return false;
+      }
 
-    boolean isOn_temp; byte speed_temp;
-    byte numerator, denominator;
-    GB_Controller.unpackFanSpeedValue(fanSpeedValue, isOn_temp, speed_temp, numerator, denominator);
-    fanSpeedValue = GB_Controller.packFanSpeedValue(isOn, speed, numerator, denominator);
+      byte fanSpeedValue;
+      byte fanSpeedDayColdTemperature, fanSpeedDayNormalTemperature, fanSpeedDayHotTemperature,
+           fanSpeedNightColdTemperature, fanSpeedNightNormalTemperature,fanSpeedNightHotTemperature;
+      GB_StorageHelper.getFanParameters(
+          fanSpeedDayColdTemperature, fanSpeedDayNormalTemperature, fanSpeedDayHotTemperature,
+          fanSpeedNightColdTemperature, fanSpeedNightNormalTemperature, fanSpeedNightHotTemperature);
 
-    if (StringUtils::flashStringEquals(name, F("dayColdSpeed"))) {
-      GB_StorageHelper.setFanSpeedDayColdTemperature(fanSpeedValue);
-    }
-    else if (StringUtils::flashStringEquals(name, F("dayNormalSpeed"))){
-      GB_StorageHelper.setFanSpeedDayNormalTemperature(fanSpeedValue);
-    }
-    else if (StringUtils::flashStringEquals(name, F("dayHotSpeed"))){
-      GB_StorageHelper.setFanSpeedDayHotTemperature(fanSpeedValue);
-    }
-    else if (StringUtils::flashStringEquals(name, F("nightColdSpeed"))){
-      GB_StorageHelper.setFanSpeedNightColdTemperature(fanSpeedValue);
-    }
-    else if (StringUtils::flashStringEquals(name, F("nightNormalSpeed"))){
-      GB_StorageHelper.setFanSpeedNightNormalTemperature(fanSpeedValue);
-    }
-    else if (StringUtils::flashStringEquals(name, F("nightHotSpeed"))){
-      GB_StorageHelper.setFanSpeedNightHotTemperature(fanSpeedValue);
-    }
-    else {
-      return false;
-    }
-    c_isWifiForceUpdateGrowboxState = true;
-  }
-  else if (StringUtils::flashStringEquals(name, F("dayColdRatio")) ||
-      StringUtils::flashStringEquals(name, F("dayNormalRatio")) ||
-      StringUtils::flashStringEquals(name, F("dayHotRatio")) ||
-      StringUtils::flashStringEquals(name, F("nightColdRatio")) ||
-      StringUtils::flashStringEquals(name, F("nightNormalRatio")) ||
-      StringUtils::flashStringEquals(name, F("nightHotRatio"))) {
-    if (value.length() == 0) {
-      return false;
-    }
-    boolean isZero = false;
-    if (value.length() == 1) {
-      if (value[0] == '0') {
-        isZero = true;
+      if (field == POST_FIELD_DAY_COLD_SPEED) {
+        fanSpeedValue = fanSpeedDayColdTemperature;
+      }
+      else if (field == POST_FIELD_DAY_NORMAL_SPEED){
+        fanSpeedValue = fanSpeedDayNormalTemperature;
+      }
+      else if (field == POST_FIELD_DAY_HOT_SPEED){
+        fanSpeedValue = fanSpeedDayHotTemperature;
+      }
+      else if (field == POST_FIELD_NIGHT_COLD_SPEED){
+        fanSpeedValue = fanSpeedNightColdTemperature;
+      }
+      else if (field == POST_FIELD_NIGHT_NORMAL_SPEED){
+        fanSpeedValue = fanSpeedNightNormalTemperature;
+      }
+      else if (field == POST_FIELD_NIGHT_HOT_SPEED){
+        fanSpeedValue = fanSpeedNightHotTemperature;
+      }
+      else {
+        return false;
       }
-    }
-    int16_t intValue = value.toInt();
-    if (intValue == 0 && !isZero) {
-      return false;
-    }
-    byte numerator, denominator;
-    GB_Controller.getNumeratorDenominatorByIndex(intValue, numerator, denominator);
 
-    byte fanSpeedValue;
-    byte fanSpeedDayColdTemperature, fanSpeedDayNormalTemperature, fanSpeedDayHotTemperature,
-         fanSpeedNightColdTemperature, fanSpeedNightNormalTemperature,fanSpeedNightHotTemperature;
-    GB_StorageHelper.getFanParameters(
-        fanSpeedDayColdTemperature, fanSpeedDayNormalTemperature, fanSpeedDayHotTemperature,
-        fanSpeedNightColdTemperature, fanSpeedNightNormalTemperature, fanSpeedNightHotTemperature);
+      boolean isOn_temp; byte speed_temp;
+      byte numerator, denominator;
+      GB_Controller.unpackFanSpeedValue(fanSpeedValue, isOn_temp, speed_temp, numerator, denominator);
+      fanSpeedValue = GB_Controller.packFanSpeedValue(isOn, speed, numerator, denominator);
 
-    if (StringUtils::flashStringEquals(name, F("dayColdRatio"))) {
-      fanSpeedValue = fanSpeedDayColdTemperature;
-    }
-    else if (StringUtils::flashStringEquals(name, F("dayNormalRatio"))){
-      fanSpeedValue = fanSpeedDayNormalTemperature;
-    }
-    else if (StringUtils::flashStringEquals(name, F("dayHotRatio"))){
-      fanSpeedValue = fanSpeedDayHotTemperature;
-    }
-    else if (StringUtils::flashStringEquals(name, F("nightColdRatio"))){
-      fanSpeedValue = fanSpeedNightColdTemperature;
-    }
-    else if (StringUtils::flashStringEquals(name, F("nightNormalRatio"))){
-      fanSpeedValue = fanSpeedNightNormalTemperature;
-    }
-    else if (StringUtils::flashStringEquals(name, F("nightHotRatio"))){
-      fanSpeedValue = fanSpeedNightHotTemperature;
-    }
-    else {
-      return false;
-    }
+      if (field == POST_FIELD_DAY_COLD_SPEED) {
+        GB_StorageHelper.setFanSpeedDayColdTemperature(fanSpeedValue);
+      }
+      else if (field == POST_FIELD_DAY_NORMAL_SPEED){
+        GB_StorageHelper.setFanSpeedDayNormalTemperature(fanSpeedValue);
+      }
+      else if (field == POST_FIELD_DAY_HOT_SPEED){
+        GB_StorageHelper.setFanSpeedDayHotTemperature(fanSpeedValue);
+      }
+      else if (field == POST_FIELD_NIGHT_COLD_SPEED){
+        GB_StorageHelper.setFanSpeedNightColdTemperature(fanSpeedValue);
+      }
+      else if (field == POST_FIELD_NIGHT_NORMAL_SPEED){
+        GB_StorageHelper.setFanSpeedNightNormalTemperature(fanSpeedValue);
+      }
+      else if (field == POST_FIELD_NIGHT_HOT_SPEED){
+        GB_StorageHelper.setFanSpeedNightHotTemperature(fanSpeedValue);
+      }
+      else {
+        return false;
+      }
+      c_isWifiForceUpdateGrowboxState = true;
+      break;
+    }
+    case POST_FIELD_DAY_COLD_RATIO:
+    case POST_FIELD_DAY_NORMAL_RATIO:
+    case POST_FIELD_DAY_HOT_RATIO:
+    case POST_FIELD_NIGHT_COLD_RATIO:
+    case POST_FIELD_NIGHT_NORMAL_RATIO:
+    case POST_FIELD_NIGHT_HOT_RATIO: {
+      if (value[0] == 0x00) {
+        return false;
+      }
+      boolean isZero = false;
+      if (strlen(value) == 1) {
+        if (value[0] == '0') {
+          isZero = true;
+        }
+      }
+      int16_t intValue = atoi(value);
+      if (intValue == 0 && !isZero) {
+        return false;
+      }
+      byte numerator, denominator;
+      GB_Controller.getNumeratorDenominatorByIndex(intValue, numerator, denominator);
+
+      byte fanSpeedValue;
+      byte fanSpeedDayColdTemperature, fanSpeedDayNormalTemperature, fanSpeedDayHotTemperature,
+           fanSpeedNightColdTemperature, fanSpeedNightNormalTemperature,fanSpeedNightHotTemperature;
+      GB_StorageHelper.getFanParameters(
+          fanSpeedDayColdTemperature, fanSpeedDayNormalTemperature, fanSpeedDayHotTemperature,
+          fanSpeedNightColdTemperature, fanSpeedNightNormalTemperature, fanSpeedNightHotTemperature);
+
+      if (field == POST_FIELD_DAY_COLD_RATIO) {
+        fanSpeedValue = fanSpeedDayColdTemperature;
+      }
+      else if (field == POST_FIELD_DAY_NORMAL_RATIO){
+        fanSpeedValue = fanSpeedDayNormalTemperature;
+      }
+      else if (field == POST_FIELD_DAY_HOT_RATIO){
+        fanSpeedValue = fanSpeedDayHotTemperature;
+      }
+      else if (field == POST_FIELD_NIGHT_COLD_RATIO){
+        fanSpeedValue = fanSpeedNightColdTemperature;
+      }
+      else if (field == POST_FIELD_NIGHT_NORMAL_RATIO){
+        fanSpeedValue = fanSpeedNightNormalTemperature;
+      }
+      else if (field == POST_FIELD_NIGHT_HOT_RATIO){
+        fanSpeedValue = fanSpeedNightHotTemperature;
+      }
+      else {
+        return false;
+      }
 
-    boolean isOn; byte speed;
-    byte numerator_temp, denominator_temp;
-    GB_Controller.unpackFanSpeedValue(fanSpeedValue, isOn, speed, numerator_temp, denominator_temp);
-    fanSpeedValue = GB_Controller.packFanSpeedValue(isOn, speed, numerator, denominator);
+      boolean isOn; byte speed;
+      byte numerator_temp, denominator_temp;
+      GB_Controller.unpackFanSpeedValue(fanSpeedValue, isOn, speed, numerator_temp, denominator_temp);
+      fanSpeedValue = GB_Controller.packFanSpeedValue(isOn, speed, numerator, denominator);
 
-    if (StringUtils::flashStringEquals(name, F("dayColdRatio"))) {
-      GB_StorageHelper.setFanSpeedDayColdTemperature(fanSpeedValue);
-    }
-    else if (StringUtils::flashStringEquals(name, F("dayNormalRatio"))){
-      GB_StorageHelper.setFanSpeedDayNormalTemperature(fanSpeedValue);
-    }
-    else if (StringUtils::flashStringEquals(name, F("dayHotRatio"))){
-      GB_StorageHelper.setFanSpeedDayHotTemperature(fanSpeedValue);
-    }
-    else if (StringUtils::flashStringEquals(name, F("nightColdRatio"))){
-      GB_StorageHelper.setFanSpeedNightColdTemperature(fanSpeedValue);
-    }
-    else if (StringUtils::flashStringEquals(name, F("nightNormalRatio"))){
-      GB_StorageHelper.setFanSpeedNightNormalTemperature(fanSpeedValue);
-    }
-    else if (StringUtils::flashStringEquals(name, F("nightHotRatio"))){
-      GB_StorageHelper.setFanSpeedNightHotTemperature(fanSpeedValue);
+      if (field == POST_FIELD_DAY_COLD_RATIO) {
+        GB_StorageHelper.setFanSpeedDayColdTemperature(fanSpeedValue);
+      }
+      else if (field == POST_FIELD_DAY_NORMAL_RATIO){
+        GB_StorageHelper.setFanSpeedDayNormalTemperature(fanSpeedValue);
+      }
+      else if (field == POST_FIELD_DAY_HOT_RATIO){
+        GB_StorageHelper.setFanSpeedDayHotTemperature(fanSpeedValue);
+      }
+      else if (field == POST_FIELD_NIGHT_COLD_RATIO){
+        GB_StorageHelper.setFanSpeedNightColdTemperature(fanSpeedValue);
+      }
+      else if (field == POST_FIELD_NIGHT_NORMAL_RATIO){
+        GB_StorageHelper.setFanSpeedNightNormalTemperature(fanSpeedValue);
+      }
+      else if (field == POST_FIELD_NIGHT_HOT_RATIO){
+        GB_StorageHelper.setFanSpeedNightHotTemperature(fanSpeedValue);
+      }
+      else {
+        return false;
+      }
+      c_isWifiForceUpdateGrowboxState = true;
+      break;
     }
-    else {
+    default:
       return false;
-    }
-    c_isWifiForceUpdateGrowboxState = true;
-  }
-  else {
-    return false;
   }
 
   return true;
@@ -0,0 +1,317 @@
+// System headers go first, Arduino.h switches structure packing on
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "EEPROMEmulator.h"
+
+#include <avr/eeprom.h>
+#include <Wire.h>
+
+#define ARDUINO_EEPROM_CAPACITY 4096 // ATmega2560
+#define AT24C32_EEPROM_CAPACITY 4096
+
+/////////////////////////////////////////////////////////////////////
+//                          EEPROM EMULATOR                        //
+/////////////////////////////////////////////////////////////////////
+
+EEPROMEmulatorClass::EEPROMEmulatorClass(word capacity) :
+    c_capacity(capacity), c_memory(NULL), c_fileDescriptor(-1),
+    c_readBytesCount(0), c_writtenBytesCount(0), c_writeCyclesCount(0), c_busyMicros(0) {
+}
+
+boolean EEPROMEmulatorClass::open(const char* fileName) {
+  close();
+
+  int fileDescriptor = ::open(fileName, O_RDWR | O_CREAT, 0644);
+  if (fileDescriptor < 0) {
+    return false;
+  }
+  struct stat fileStat;
+  if (fstat(fileDescriptor, &fileStat) != 0 || ftruncate(fileDescriptor, c_capacity) != 0) {
+    ::close(fileDescriptor);
+    return false;
+  }
+  void* memory = mmap(NULL, c_capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+  if (memory == MAP_FAILED) {
+    ::close(fileDescriptor);
+    return false;
+  }
+
+  c_fileDescriptor = fileDescriptor;
+  c_memory = (byte*)memory;
+  if (fileStat.st_size < c_capacity) {
+    // Erased EEPROM cells read as 0xFF
+    memset(c_memory + fileStat.st_size, 0xFF, c_capacity - fileStat.st_size);
+  }
+  return true;
+}
+
+void EEPROMEmulatorClass::close() {
+  if (c_memory != NULL) {
+    msync(c_memory, c_capacity, MS_SYNC);
+    munmap(c_memory, c_capacity);
+    c_memory = NULL;
+  }
+  if (c_fileDescriptor >= 0) {
+    ::close(c_fileDescriptor);
+    c_fileDescriptor = -1;
+  }
+}
+
+boolean EEPROMEmulatorClass::isOpened() {
+  return (c_memory != NULL);
+}
+
+word EEPROMEmulatorClass::getCapacity() {
+  return c_capacity;
+}
+
+byte* EEPROMEmulatorClass::getMemory() {
+  return c_memory;
+}
+
+void EEPROMEmulatorClass::erase() {
+  if (c_memory != NULL) {
+    memset(c_memory, 0xFF, c_capacity);
+  }
+}
+
+void EEPROMEmulatorClass::resetStatistics() {
+  c_readBytesCount = 0;
+  c_writtenBytesCount = 0;
+  c_writeCyclesCount = 0;
+  c_busyMicros = 0;
+}
+
+unsigned long EEPROMEmulatorClass::getReadBytesCount() {
+  return c_readBytesCount;
+}
+
+unsigned long EEPROMEmulatorClass::getWrittenBytesCount() {
+  return c_writtenBytesCount;
+}
+
+unsigned long EEPROMEmulatorClass::getWriteCyclesCount() {
+  return c_writeCyclesCount;
+}
+
+unsigned long long EEPROMEmulatorClass::getBusyMicros() {
+  return c_busyMicros;
+}
+
+byte EEPROMEmulatorClass::readByte(word address) {
+  spendMicros(ARDUINO_EEPROM_READ_BYTE_US);
+  c_readBytesCount++;
+  if (c_memory == NULL || address >= c_capacity) {
+    return 0xFF;
+  }
+  return c_memory[address];
+}
+
+void EEPROMEmulatorClass::writeByte(word address, byte value) {
+  spendMicros(ARDUINO_EEPROM_WRITE_BYTE_US);
+  c_writtenBytesCount++;
+  c_writeCyclesCount++;
+  if (c_memory == NULL || address >= c_capacity) {
+    return;
+  }
+  c_memory[address] = value;
+}
+
+void EEPROMEmulatorClass::spendMicros(unsigned long us) {
+  c_busyMicros += us;
+  HOST_advanceMicros(us);
+}
+
+/////////////////////////////////////////////////////////////////////
+//                         AT24C32 EMULATOR                        //
+/////////////////////////////////////////////////////////////////////
+
+AT24C32EmulatorClass::AT24C32EmulatorClass() :
+    EEPROMEmulatorClass(AT24C32_EEPROM_CAPACITY), c_addressCounter(0), c_writeCycleStartMicros(0), c_isWriteCycle(false) {
+}
+
+boolean AT24C32EmulatorClass::isWriteCycle() {
+  if (c_isWriteCycle && (micros() - c_writeCycleStartMicros >= AT24C32_WRITE_CYCLE_US)) {
+    c_isWriteCycle = false;
+  }
+  return c_isWriteCycle;
+}
+
+boolean AT24C32EmulatorClass::receiveTransmission(const byte data[], byte count) {
+  if (c_memory == NULL || isWriteCycle()) {
+    spendMicros(I2C_START_STOP_US + I2C_BYTE_US); // device address NACK
+    return false;
+  }
+  spendMicros(I2C_START_STOP_US + (1 + count) * I2C_BYTE_US);
+  if (count < 2) {
+    return true; // address poll
+  }
+
+  c_addressCounter = ((data[0] << 8) | data[1]) % c_capacity;
+  if (count == 2) {
+    return true; // dummy write before random read
+  }
+
+  // Page write: lower 5 bits of address counter roll over inside page (see spec)
+  word pageStart = c_addressCounter - (c_addressCounter % AT24C32_EMULATOR_PAGE_SIZE);
+  for (byte i = 2; i < count; i++) {
+    c_memory[c_addressCounter] = data[i];
+    c_addressCounter = pageStart + ((c_addressCounter + 1) % AT24C32_EMULATOR_PAGE_SIZE);
+    c_writtenBytesCount++;
+  }
+  c_writeCyclesCount++;
+  c_isWriteCycle = true;
+  c_writeCycleStartMicros = micros();
+  c_busyMicros += AT24C32_WRITE_CYCLE_US; // counted here, clock is moved by acknowledge polling
+  return true;
+}
+
+boolean AT24C32EmulatorClass::sendRequested(byte data[], byte count) {
+  if (c_memory == NULL || isWriteCycle()) {
+    spendMicros(I2C_START_STOP_US + I2C_BYTE_US); // device address NACK
+    return false;
+  }
+  spendMicros(I2C_START_STOP_US + (1 + count) * I2C_BYTE_US);
+  // Sequential read: address counter rolls over whole memory (see spec)
+  for (byte i = 0; i < count; i++) {
+    data[i] = c_memory[c_addressCounter];
+    c_addressCounter = (c_addressCounter + 1) % c_capacity;
+    c_readBytesCount++;
+  }
+  return true;
+}
+
+EEPROMEmulatorClass HOST_EEPROM(ARDUINO_EEPROM_CAPACITY);
+AT24C32EmulatorClass HOST_EEPROM_AT24C32;
+
+/////////////////////////////////////////////////////////////////////
+//                       avr/eeprom.h BACKEND                      //
+/////////////////////////////////////////////////////////////////////
+
+int eeprom_is_ready() {
+  return HOST_EEPROM.isOpened();
+}
+
+uint8_t eeprom_read_byte(const uint8_t *address) {
+  return HOST_EEPROM.readByte((word)(uintptr_t)address);
+}
+
+void eeprom_write_byte(uint8_t *address, uint8_t value) {
+  HOST_EEPROM.writeByte((word)(uintptr_t)address, value);
+}
+
+void eeprom_read_block(void *dst, const void *src, size_t size) {
+  uint8_t* bytePointer = (uint8_t*)dst;
+  for (size_t i = 0; i < size; i++) {
+    bytePointer[i] = HOST_EEPROM.readByte((word)((uintptr_t)src + i));
+  }
+}
+
+void eeprom_write_block(const void *src, void *dst, size_t size) {
+  const uint8_t* bytePointer = (const uint8_t*)src;
+  for (size_t i = 0; i < size; i++) {
+    HOST_EEPROM.writeByte((word)((uintptr_t)dst + i), bytePointer[i]);
+  }
+}
+
+/////////////////////////////////////////////////////////////////////
+//                          Wire.h BACKEND                         //
+/////////////////////////////////////////////////////////////////////
+
+static uint8_t g_txAddress = 0;
+static uint8_t g_txBuffer[BUFFER_LENGTH];
+static uint8_t g_txBufferLength = 0;
+static boolean g_isTxOverflow = false;
+
+static uint8_t g_rxBuffer[BUFFER_LENGTH];
+static uint8_t g_rxBufferIndex = 0;
+static uint8_t g_rxBufferLength = 0;
+
+void TwoWire::begin() {
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+  g_txAddress = address;
+  g_txBufferLength = 0;
+  g_isTxOverflow = false;
+}
+
+void TwoWire::beginTransmission(int address) {
+  beginTransmission((uint8_t)address);
+}
+
+uint8_t TwoWire::endTransmission() {
+  if (g_isTxOverflow) {
+    return 1; // data too long to fit in transmit buffer
+  }
+  if (g_txAddress != AT24C32_EMULATOR_I2C_ADDRESS) {
+    HOST_advanceMicros(I2C_START_STOP_US + I2C_BYTE_US);
+    return 2;
+  }
+  if (!HOST_EEPROM_AT24C32.receiveTransmission(g_txBuffer, g_txBufferLength)) {
+    return 2; // received NACK on transmit of address
+  }
+  return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity) {
+  if (quantity > BUFFER_LENGTH) {
+    quantity = BUFFER_LENGTH;
+  }
+  g_rxBufferIndex = 0;
+  g_rxBufferLength = 0;
+  if (address != AT24C32_EMULATOR_I2C_ADDRESS) {
+    HOST_advanceMicros(I2C_START_STOP_US + I2C_BYTE_US);
+    return 0;
+  }
+  if (!HOST_EEPROM_AT24C32.sendRequested(g_rxBuffer, quantity)) {
+    return 0;
+  }
+  g_rxBufferLength = quantity;
+  return quantity;
+}
+
+uint8_t TwoWire::requestFrom(int address, int quantity) {
+  return requestFrom((uint8_t)address, (uint8_t)quantity);
+}
+
+size_t TwoWire::write(uint8_t data) {
+  if (g_txBufferLength >= BUFFER_LENGTH) {
+    g_isTxOverflow = true;
+    return 0;
+  }
+  g_txBuffer[g_txBufferLength++] = data;
+  return 1;
+}
+
+size_t TwoWire::write(const uint8_t *data, size_t quantity) {
+  for (size_t i = 0; i < quantity; i++) {
+    if (write(data[i]) == 0) {
+      return i;
+    }
+  }
+  return quantity;
+}
+
+int TwoWire::available() {
+  return g_rxBufferLength - g_rxBufferIndex;
+}
+
+int TwoWire::read() {
+  if (g_rxBufferIndex >= g_rxBufferLength) {
+    return -1;
+  }
+  return g_rxBuffer[g_rxBufferIndex++];
+}
+
+int TwoWire::peek() {
+  if (g_rxBufferIndex >= g_rxBufferLength) {
+    return -1;
+  }
+  return g_rxBuffer[g_rxBufferIndex];
+}
+
+TwoWire Wire;
@@ -0,0 +1,87 @@
+#ifndef EEPROMEmulator_h
+#define EEPROMEmulator_h
+
+#include <Arduino.h>
+
+/////////////////////////////////////////////////////////////////////
+//                          LATENCY MODELS                         //
+/////////////////////////////////////////////////////////////////////
+
+// ATmega2560 internal EEPROM: CPU is halted 4 cycles on read, erase and write takes 3.3 ms
+const unsigned long ARDUINO_EEPROM_READ_BYTE_US = 1;
+const unsigned long ARDUINO_EEPROM_WRITE_BYTE_US = 3300;
+
+// AT24C32 on I2C bus at 100 kHz: 8 bits + ACK per byte, self-timed write cycle
+// is 10 ms max at 5V (see spec), device doesn't acknowledge its address during it
+const unsigned long I2C_BYTE_US = 90;
+const unsigned long I2C_START_STOP_US = 10;
+const unsigned long AT24C32_WRITE_CYCLE_US = 5000;
+const byte AT24C32_EMULATOR_I2C_ADDRESS = 0x50;
+const byte AT24C32_EMULATOR_PAGE_SIZE = 32;
+
+/////////////////////////////////////////////////////////////////////
+//                             EMULATORS                           //
+/////////////////////////////////////////////////////////////////////
+
+// EEPROM memory is mapped to file, so stored log survives between runs like on real chip.
+// New file is filled with 0xFF like erased EEPROM
+class EEPROMEmulatorClass{
+protected:
+  const word c_capacity;
+  byte* c_memory;
+  int c_fileDescriptor;
+
+  unsigned long c_readBytesCount;
+  unsigned long c_writtenBytesCount;
+  unsigned long c_writeCyclesCount;
+  unsigned long long c_busyMicros;
+
+public:
+  EEPROMEmulatorClass(word capacity);
+
+  boolean open(const char* fileName);
+  void close();
+  boolean isOpened();
+  word getCapacity();
+
+  // Host side access, no latency
+  byte* getMemory();
+  void erase();
+
+  void resetStatistics();
+  unsigned long getReadBytesCount();
+  unsigned long getWrittenBytesCount();
+  unsigned long getWriteCyclesCount();
+  unsigned long long getBusyMicros();
+
+  // Device side access used by avr/eeprom.h backend, each call costs emulated time
+  byte readByte(word address);
+  void writeByte(word address, byte value);
+
+protected:
+  void spendMicros(unsigned long us);
+};
+
+class AT24C32EmulatorClass : public EEPROMEmulatorClass{
+private:
+  word c_addressCounter;
+  unsigned long c_writeCycleStartMicros;
+  boolean c_isWriteCycle;
+
+public:
+  AT24C32EmulatorClass();
+
+  // Device side of I2C transactions used by Wire.h backend, return false on address NACK
+  boolean receiveTransmission(const byte data[], byte count);
+  boolean sendRequested(byte data[], byte count);
+
+private:
+  boolean isWriteCycle();
+};
+
+// Internal ATmega2560 EEPROM behind avr/eeprom.h
+extern EEPROMEmulatorClass HOST_EEPROM;
+// External AT24C32 behind Wire.h
+extern AT24C32EmulatorClass HOST_EEPROM_AT24C32;
+
+#endif
@@ -0,0 +1,54 @@
+#include "Controller.h"
+#include "Thermometer.h"
+
+// Controller and thermometer are not linked into host build, only methods used by
+// storage and logger are here. Host has no RTC and no thermometer
+
+/////////////////////////////////////////////////////////////////////
+//                            CONTROLLER                           //
+/////////////////////////////////////////////////////////////////////
+
+ControllerClass::ControllerClass() :
+    c_lastFreeMemory(0), c_isAutoCalculatedClockTimeUsed(false), c_lastBreezeTimeStamp(0), c_isDayInGrowbox(false),
+    c_fan_cycleCounter(0), c_fan_isOn(false), c_fan_speed(FAN_SPEED_LOW), c_fan_numerator(0), c_fan_denominator(0) {
+}
+
+void ControllerClass::updateBreeze() {
+}
+
+boolean ControllerClass::isRTCPresent() {
+  return false;
+}
+
+byte ControllerClass::packFanSpeedValue(boolean isOn, byte speed, byte numerator, byte denominator) {
+  if (isOn) {
+    return B10000000 | (speed == FAN_SPEED_HIGH ? B01000000 : 0);
+  }
+  else {
+    return 0;
+  }
+}
+
+ControllerClass GB_Controller;
+
+/////////////////////////////////////////////////////////////////////
+//                           THERMOMETER                           //
+/////////////////////////////////////////////////////////////////////
+
+ThermometerClass::ThermometerClass(OneWire* oneWirePin) :
+    c_dallasTemperature(oneWirePin), c_lastTemperature(NAN), c_statisticsTemperatureSumm(0.0), c_statisticsTemperatureCount(0) {
+}
+
+boolean ThermometerClass::isPresent() {
+  return false;
+}
+
+ThermometerClass GB_Thermometer(&g_oneWirePin);
+
+/////////////////////////////////////////////////////////////////////
+//                              MEMORY                             //
+/////////////////////////////////////////////////////////////////////
+
+int freeMemory() {
+  return 8192 - 2048; // ATmega2560 SRAM minus typical usage
+}
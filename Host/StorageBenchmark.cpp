@@ -0,0 +1,190 @@
+// Measures log storage on emulated EEPROM: storeLogRecords() throughput, full cursor scan
+// and boot-record load with log head restore. Times are emulated device times, see EEPROMEmulator.h
+//
+// Usage: storage_benchmark [records count] [Arduino EEPROM file] [AT24C32 EEPROM file]
+
+#include "EEPROMEmulator.h"
+
+#include "StorageHelper.h"
+#include "Logger.h"
+
+const unsigned long DEFAULT_RECORDS_COUNT = 4000; // log ring is wrapped at least once
+const time_t BENCHMARK_START_TIME = 1420070400UL; // 2015-01-01
+
+struct BenchmarkResult{
+  unsigned long storedRecordsCount;
+  unsigned long long storeMicros;
+  unsigned long writtenBytesCount;
+  unsigned long writeCyclesCount;
+  word scannedRecordsCount;
+  unsigned long long scanMicros;
+  unsigned long readBytesCount;
+  unsigned long long bootMicros;
+  unsigned long bootRecordLoadTime;
+  unsigned long logHeadRestoreTime;
+};
+
+/////////////////////////////////////////////////////////////////////
+//                             RECORDS                             //
+/////////////////////////////////////////////////////////////////////
+
+// Typical growbox log: temperature every 5 minutes, device events and watering with values,
+// sometimes power cut gap which starts new block
+static LogRecord makeLogRecord(unsigned long index, time_t& timeStamp) {
+  static const time_t TIME_DELTAS[] = { 300, 2, 40, 900 };
+  timeStamp += TIME_DELTAS[index % 4];
+  if (index % 100 == 99) {
+    timeStamp += 20000;
+  }
+
+  LogRecord logRecord;
+  switch (index % 4) {
+    case 0:
+      logRecord = LogRecord(B11000000 | (20 + index % 8)); // temperature
+      break;
+    case 1:
+      logRecord = LogRecord(B00000000 | 10); // event "Fan low speed"
+      break;
+    case 2:
+      logRecord = LogRecord(B10000000 | (1 << 4) | 15, 1 + index % 200); // watering event with value
+      break;
+    default:
+      logRecord = LogRecord(B01000000 | (2 << 4) | B000); // error with 3 blinks
+      break;
+  }
+  logRecord.timeStamp = timeStamp;
+  return logRecord;
+}
+
+static unsigned long long getBusyMicros() {
+  return HOST_EEPROM.getBusyMicros() + HOST_EEPROM_AT24C32.getBusyMicros();
+}
+
+static void resetStatistics() {
+  HOST_EEPROM.resetStatistics();
+  HOST_EEPROM_AT24C32.resetStatistics();
+}
+
+/////////////////////////////////////////////////////////////////////
+//                            BENCHMARK                            //
+/////////////////////////////////////////////////////////////////////
+
+static boolean runBenchmark(const char* title, unsigned long recordsCount, BenchmarkResult& result) {
+  memset(&result, 0, sizeof(result));
+  HOST_EEPROM.erase();
+  HOST_EEPROM_AT24C32.erase();
+  setTime(BENCHMARK_START_TIME);
+
+  // First start up on erased EEPROM
+  StorageHelperClass storageHelper;
+  storageHelper.init_getLastStoredTime();
+  storageHelper.init_loadConfiguration(now());
+
+  // Store records in batches like Logger flushes its pending buffer
+  time_t timeStamp = now();
+  LogRecord lastLogRecord;
+  resetStatistics();
+  unsigned long index = 0;
+  while (index < recordsCount) {
+    LogRecord logRecords[LOGGER_PENDING_RECORDS_CAPACITY];
+    byte logRecordsCount = 0;
+    while (logRecordsCount < LOGGER_PENDING_RECORDS_CAPACITY && index < recordsCount) {
+      logRecords[logRecordsCount++] = makeLogRecord(index++, timeStamp);
+    }
+    setTime(timeStamp);
+    unsigned long long startMicros = getBusyMicros();
+    byte storedCount = storageHelper.storeLogRecords(logRecords, logRecordsCount);
+    result.storeMicros += getBusyMicros() - startMicros;
+    result.storedRecordsCount += storedCount;
+    if (storedCount != logRecordsCount) {
+      printf("%s: stored %u of %u records\n", title, storedCount, logRecordsCount);
+      return false;
+    }
+    lastLogRecord = logRecords[logRecordsCount - 1];
+  }
+  storageHelper.commitLogDayIndex();
+  result.writtenBytesCount = HOST_EEPROM.getWrittenBytesCount() + HOST_EEPROM_AT24C32.getWrittenBytesCount();
+  result.writeCyclesCount = HOST_EEPROM.getWriteCyclesCount() + HOST_EEPROM_AT24C32.getWriteCyclesCount();
+
+  // Full scan by cursor
+  resetStatistics();
+  unsigned long long startMicros = getBusyMicros();
+  LogRecordsCursor cursor;
+  LogRecord logRecord, lastScannedLogRecord;
+  storageHelper.openLogRecordsCursor(cursor);
+  while (storageHelper.nextLogRecord(cursor, logRecord)) {
+    result.scannedRecordsCount++;
+    lastScannedLogRecord = logRecord;
+  }
+  result.scanMicros = getBusyMicros() - startMicros;
+  result.readBytesCount = HOST_EEPROM.getReadBytesCount() + HOST_EEPROM_AT24C32.getReadBytesCount();
+
+  // Reboot: boot record and log head are loaded by new instance
+  resetStatistics();
+  startMicros = getBusyMicros();
+  StorageHelperClass rebootedStorageHelper;
+  time_t lastStoredTime = rebootedStorageHelper.init_getLastStoredTime();
+  result.bootMicros = getBusyMicros() - startMicros;
+  result.bootRecordLoadTime = rebootedStorageHelper.getStorageStatistics().bootRecordLoadTime;
+  result.logHeadRestoreTime = rebootedStorageHelper.getStorageStatistics().logHeadRestoreTime;
+
+  boolean isCorrect = true;
+  if (result.scannedRecordsCount != storageHelper.getLogRecordsCount()) {
+    printf("%s: scanned %u records, log has %u\n", title, result.scannedRecordsCount, storageHelper.getLogRecordsCount());
+    isCorrect = false;
+  }
+  if (lastScannedLogRecord.timeStamp != lastLogRecord.timeStamp || lastScannedLogRecord.data != lastLogRecord.data
+      || lastScannedLogRecord.data1 != lastLogRecord.data1) {
+    printf("%s: last scanned record differs from last stored one\n", title);
+    isCorrect = false;
+  }
+  if (lastStoredTime != lastLogRecord.timeStamp) {
+    printf("%s: last stored time %lu after reboot, expected %lu\n", title, (unsigned long)lastStoredTime, (unsigned long)lastLogRecord.timeStamp);
+    isCorrect = false;
+  }
+  return isCorrect;
+}
+
+static void printResult(const char* title, const BenchmarkResult& result) {
+  printf("\n%s\n", title);
+  printf("  store:  %lu records, %.1f ms total, %.2f ms/record, %.1f records/s, %lu bytes written, %lu write cycles\n",
+      result.storedRecordsCount, result.storeMicros / 1000.0,
+      result.storeMicros / 1000.0 / result.storedRecordsCount,
+      result.storedRecordsCount * 1000000.0 / result.storeMicros,
+      result.writtenBytesCount, result.writeCyclesCount);
+  printf("  scan:   %u records, %.1f ms total, %.1f us/record, %lu bytes read\n",
+      result.scannedRecordsCount, result.scanMicros / 1000.0,
+      (double)result.scanMicros / result.scannedRecordsCount, result.readBytesCount);
+  printf("  boot:   %.1f ms total, boot record load %.1f ms, log head restore %.1f ms\n",
+      result.bootMicros / 1000.0, result.bootRecordLoadTime / 1000.0, result.logHeadRestoreTime / 1000.0);
+}
+
+int main(int argc, char* argv[]) {
+  unsigned long recordsCount = (argc > 1) ? strtoul(argv[1], NULL, 10) : DEFAULT_RECORDS_COUNT;
+  const char* arduinoFileName = (argc > 2) ? argv[2] : "eeprom_arduino.bin";
+  const char* at24c32FileName = (argc > 3) ? argv[3] : "eeprom_at24c32.bin";
+
+  if (!HOST_EEPROM.open(arduinoFileName)) {
+    printf("Can't open %s\n", arduinoFileName);
+    return 1;
+  }
+  initLoggerModel();
+
+  boolean isCorrect = true;
+  BenchmarkResult result;
+
+  // Without AT24C32 log is stored in Arduino EEPROM only
+  isCorrect &= runBenchmark("Arduino EEPROM", recordsCount, result);
+  printResult("Arduino EEPROM", result);
+
+  if (!HOST_EEPROM_AT24C32.open(at24c32FileName)) {
+    printf("Can't open %s\n", at24c32FileName);
+    return 1;
+  }
+  isCorrect &= runBenchmark("Arduino EEPROM + AT24C32", recordsCount, result);
+  printResult("Arduino EEPROM + AT24C32", result);
+
+  HOST_EEPROM_AT24C32.close();
+  HOST_EEPROM.close();
+  return isCorrect ? 0 : 1;
+}
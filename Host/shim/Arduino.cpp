@@ -0,0 +1,564 @@
+#include "Arduino.h"
+
+/////////////////////////////////////////////////////////////////////
+//                          VIRTUAL CLOCK                          //
+/////////////////////////////////////////////////////////////////////
+
+static unsigned long long g_virtualMicros = 0;
+
+void HOST_advanceMicros(unsigned long us) {
+  g_virtualMicros += us;
+}
+
+unsigned long millis() {
+  return (unsigned long)(uint32_t)(g_virtualMicros / 1000); // overflows like on AVR
+}
+
+unsigned long micros() {
+  return (unsigned long)(uint32_t)g_virtualMicros;
+}
+
+void delay(unsigned long ms) {
+  g_virtualMicros += ms * 1000ULL;
+}
+
+void delayMicroseconds(unsigned int us) {
+  g_virtualMicros += us;
+}
+
+/////////////////////////////////////////////////////////////////////
+//                               PINS                              //
+/////////////////////////////////////////////////////////////////////
+
+void pinMode(uint8_t pin, uint8_t mode) {
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+}
+
+int digitalRead(uint8_t pin) {
+  return HIGH; // hardware buttons use pullup, HIGH is released
+}
+
+int analogRead(uint8_t pin) {
+  return 1023; // wet sensor not connected
+}
+
+/////////////////////////////////////////////////////////////////////
+//                              STRING                             //
+/////////////////////////////////////////////////////////////////////
+
+String::String(const char *cstr) :
+    c_buffer(NULL), c_capacity(0), c_length(0) {
+  concat(cstr);
+}
+
+String::String(const String &str) :
+    c_buffer(NULL), c_capacity(0), c_length(0) {
+  concat(str);
+}
+
+String::String(const __FlashStringHelper *str) :
+    c_buffer(NULL), c_capacity(0), c_length(0) {
+  concat((const char*)str);
+}
+
+String::String(char c) :
+    c_buffer(NULL), c_capacity(0), c_length(0) {
+  concat(c);
+}
+
+static void formatNumber(char *buf, unsigned long value, unsigned char base) {
+  char digits[sizeof(unsigned long) * 8 + 1];
+  byte count = 0;
+  if (base < 2) {
+    base = 10;
+  }
+  do {
+    byte digit = value % base;
+    digits[count++] = (digit < 10) ? ('0' + digit) : ('A' + digit - 10);
+    value /= base;
+  }
+  while (value != 0);
+  while (count > 0) {
+    *buf++ = digits[--count];
+  }
+  *buf = '\0';
+}
+
+String::String(unsigned char value, unsigned char base) :
+    c_buffer(NULL), c_capacity(0), c_length(0) {
+  char buf[sizeof(unsigned long) * 8 + 1];
+  formatNumber(buf, value, base);
+  concat(buf);
+}
+
+String::String(int value, unsigned char base) :
+    c_buffer(NULL), c_capacity(0), c_length(0) {
+  char buf[sizeof(unsigned long) * 8 + 2];
+  if (base == DEC && value < 0) {
+    buf[0] = '-';
+    formatNumber(buf + 1, -(long)value, base);
+  }
+  else {
+    formatNumber(buf, (unsigned int)value, base);
+  }
+  concat(buf);
+}
+
+String::String(unsigned int value, unsigned char base) :
+    c_buffer(NULL), c_capacity(0), c_length(0) {
+  char buf[sizeof(unsigned long) * 8 + 1];
+  formatNumber(buf, value, base);
+  concat(buf);
+}
+
+String::String(long value, unsigned char base) :
+    c_buffer(NULL), c_capacity(0), c_length(0) {
+  char buf[sizeof(unsigned long) * 8 + 2];
+  if (base == DEC && value < 0) {
+    buf[0] = '-';
+    formatNumber(buf + 1, -value, base);
+  }
+  else {
+    formatNumber(buf, (unsigned long)value, base);
+  }
+  concat(buf);
+}
+
+String::String(unsigned long value, unsigned char base) :
+    c_buffer(NULL), c_capacity(0), c_length(0) {
+  char buf[sizeof(unsigned long) * 8 + 1];
+  formatNumber(buf, value, base);
+  concat(buf);
+}
+
+String::String(float value, unsigned char decimalPlaces) :
+    c_buffer(NULL), c_capacity(0), c_length(0) {
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%.*f", decimalPlaces, (double)value);
+  concat(buf);
+}
+
+String::String(double value, unsigned char decimalPlaces) :
+    c_buffer(NULL), c_capacity(0), c_length(0) {
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%.*f", decimalPlaces, value);
+  concat(buf);
+}
+
+String::~String() {
+  free(c_buffer);
+}
+
+String& String::operator=(const String &rhs) {
+  if (this != &rhs) {
+    c_length = 0;
+    concat(rhs);
+  }
+  return *this;
+}
+
+String& String::operator=(const char *cstr) {
+  String copy(cstr); // cstr may point into this string
+  c_length = 0;
+  concat(copy);
+  return *this;
+}
+
+unsigned char String::reserve(unsigned int size) {
+  if (c_buffer != NULL && c_capacity >= size) {
+    return 1;
+  }
+  char *newBuffer = (char*)realloc(c_buffer, size + 1);
+  if (newBuffer == NULL) {
+    return 0;
+  }
+  c_buffer = newBuffer;
+  c_capacity = size;
+  c_buffer[c_length] = '\0';
+  return 1;
+}
+
+unsigned int String::length() const {
+  return c_length;
+}
+
+unsigned char String::concat(const String &str) {
+  unsigned int strLength = str.c_length; // str may be this string
+  if (!reserve(c_length + strLength)) {
+    return 0;
+  }
+  memmove(c_buffer + c_length, str.c_str(), strLength);
+  c_length += strLength;
+  c_buffer[c_length] = '\0';
+  return 1;
+}
+
+unsigned char String::concat(const char *cstr) {
+  if (cstr == NULL) {
+    return 0;
+  }
+  unsigned int strLength = strlen(cstr);
+  if (!reserve(c_length + strLength)) {
+    return 0;
+  }
+  memmove(c_buffer + c_length, cstr, strLength);
+  c_length += strLength;
+  c_buffer[c_length] = '\0';
+  return 1;
+}
+
+unsigned char String::concat(char c) {
+  char buf[2] = { c, '\0' };
+  return concat(buf);
+}
+
+String& String::operator+=(const String &rhs) {
+  concat(rhs);
+  return *this;
+}
+
+String& String::operator+=(const char *cstr) {
+  concat(cstr);
+  return *this;
+}
+
+String& String::operator+=(char c) {
+  concat(c);
+  return *this;
+}
+
+String& String::operator+=(unsigned char num) {
+  concat(String(num));
+  return *this;
+}
+
+String& String::operator+=(int num) {
+  concat(String(num));
+  return *this;
+}
+
+String& String::operator+=(unsigned int num) {
+  concat(String(num));
+  return *this;
+}
+
+String& String::operator+=(long num) {
+  concat(String(num));
+  return *this;
+}
+
+String& String::operator+=(unsigned long num) {
+  concat(String(num));
+  return *this;
+}
+
+String& String::operator+=(const __FlashStringHelper *str) {
+  concat((const char*)str);
+  return *this;
+}
+
+char String::operator[](unsigned int index) const {
+  return charAt(index);
+}
+
+char& String::operator[](unsigned int index) {
+  static char dummyWriteChar;
+  if (index >= c_length) {
+    dummyWriteChar = '\0';
+    return dummyWriteChar;
+  }
+  return c_buffer[index];
+}
+
+char String::charAt(unsigned int index) const {
+  if (index >= c_length) {
+    return '\0';
+  }
+  return c_buffer[index];
+}
+
+const char* String::c_str() const {
+  return (c_buffer != NULL) ? c_buffer : "";
+}
+
+String String::substring(unsigned int beginIndex) const {
+  return substring(beginIndex, c_length);
+}
+
+String String::substring(unsigned int beginIndex, unsigned int endIndex) const {
+  if (beginIndex > endIndex) {
+    unsigned int temp = endIndex;
+    endIndex = beginIndex;
+    beginIndex = temp;
+  }
+  String out;
+  if (beginIndex >= c_length) {
+    return out;
+  }
+  if (endIndex > c_length) {
+    endIndex = c_length;
+  }
+  out.reserve(endIndex - beginIndex);
+  memcpy(out.c_buffer, c_buffer + beginIndex, endIndex - beginIndex);
+  out.c_length = endIndex - beginIndex;
+  out.c_buffer[out.c_length] = '\0';
+  return out;
+}
+
+int String::indexOf(char ch) const {
+  return indexOf(ch, 0);
+}
+
+int String::indexOf(char ch, unsigned int fromIndex) const {
+  for (unsigned int i = fromIndex; i < c_length; i++) {
+    if (c_buffer[i] == ch) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+long String::toInt() const {
+  return atol(c_str());
+}
+
+void String::toUpperCase() {
+  for (unsigned int i = 0; i < c_length; i++) {
+    c_buffer[i] = toupper(c_buffer[i]);
+  }
+}
+
+void String::getBytes(unsigned char *buf, unsigned int bufsize, unsigned int index) const {
+  if (bufsize == 0 || buf == NULL) {
+    return;
+  }
+  if (index >= c_length) {
+    buf[0] = 0;
+    return;
+  }
+  unsigned int n = bufsize - 1;
+  if (n > c_length - index) {
+    n = c_length - index;
+  }
+  memcpy(buf, c_buffer + index, n);
+  buf[n] = 0;
+}
+
+void String::toCharArray(char *buf, unsigned int bufsize, unsigned int index) const {
+  getBytes((unsigned char *)buf, bufsize, index);
+}
+
+unsigned char String::equals(const String &s) const {
+  return (c_length == s.c_length && strcmp(c_str(), s.c_str()) == 0);
+}
+
+unsigned char String::startsWith(const String &prefix) const {
+  return (c_length >= prefix.c_length && strncmp(c_str(), prefix.c_str(), prefix.c_length) == 0);
+}
+
+unsigned char String::endsWith(const String &suffix) const {
+  return (c_length >= suffix.c_length && strcmp(c_str() + c_length - suffix.c_length, suffix.c_str()) == 0);
+}
+
+String operator+(const String &lhs, const String &rhs) {
+  String out(lhs);
+  out += rhs;
+  return out;
+}
+
+String operator+(const String &lhs, const char *cstr) {
+  String out(lhs);
+  out += cstr;
+  return out;
+}
+
+String operator+(const String &lhs, char c) {
+  String out(lhs);
+  out += c;
+  return out;
+}
+
+/////////////////////////////////////////////////////////////////////
+//                              PRINT                              //
+/////////////////////////////////////////////////////////////////////
+
+size_t Print::write(const uint8_t *buffer, size_t size) {
+  size_t n = 0;
+  while (size--) {
+    n += write(*buffer++);
+  }
+  return n;
+}
+
+size_t Print::write(const char *str) {
+  if (str == NULL) {
+    return 0;
+  }
+  return write((const uint8_t *)str, strlen(str));
+}
+
+size_t Print::write(const char *buffer, size_t size) {
+  return write((const uint8_t *)buffer, size);
+}
+
+size_t Print::printNumber(unsigned long value, uint8_t base) {
+  char buf[sizeof(unsigned long) * 8 + 1];
+  formatNumber(buf, value, base);
+  return write(buf);
+}
+
+size_t Print::print(const __FlashStringHelper *str) {
+  return write((const char*)str);
+}
+
+size_t Print::print(const String &str) {
+  return write(str.c_str(), str.length());
+}
+
+size_t Print::print(const char *str) {
+  return write(str);
+}
+
+size_t Print::print(char c) {
+  return write((uint8_t)c);
+}
+
+size_t Print::print(unsigned char value, int base) {
+  return print((unsigned long)value, base);
+}
+
+size_t Print::print(int value, int base) {
+  return print((long)value, base);
+}
+
+size_t Print::print(unsigned int value, int base) {
+  return print((unsigned long)value, base);
+}
+
+size_t Print::print(long value, int base) {
+  if (base == DEC && value < 0) {
+    return print('-') + printNumber(-value, DEC);
+  }
+  if (base == DEC) {
+    return printNumber(value, DEC);
+  }
+  return printNumber((unsigned long)value, base);
+}
+
+size_t Print::print(unsigned long value, int base) {
+  if (base == 0) {
+    return write((uint8_t)value);
+  }
+  return printNumber(value, base);
+}
+
+size_t Print::print(double value, int digits) {
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%.*f", digits, value);
+  return write(buf);
+}
+
+size_t Print::println(const __FlashStringHelper *str) {
+  return print(str) + println();
+}
+
+size_t Print::println(const String &str) {
+  return print(str) + println();
+}
+
+size_t Print::println(const char *str) {
+  return print(str) + println();
+}
+
+size_t Print::println(char c) {
+  return print(c) + println();
+}
+
+size_t Print::println(unsigned char value, int base) {
+  return print(value, base) + println();
+}
+
+size_t Print::println(int value, int base) {
+  return print(value, base) + println();
+}
+
+size_t Print::println(unsigned int value, int base) {
+  return print(value, base) + println();
+}
+
+size_t Print::println(long value, int base) {
+  return print(value, base) + println();
+}
+
+size_t Print::println(unsigned long value, int base) {
+  return print(value, base) + println();
+}
+
+size_t Print::println(double value, int digits) {
+  return print(value, digits) + println();
+}
+
+size_t Print::println() {
+  return write("\r\n");
+}
+
+String Stream::readString() {
+  String ret;
+  int c = read();
+  while (c >= 0) {
+    ret += (char)c;
+    c = read();
+  }
+  return ret;
+}
+
+/////////////////////////////////////////////////////////////////////
+//                              SERIAL                             //
+/////////////////////////////////////////////////////////////////////
+
+void HardwareSerial::begin(unsigned long baud) {
+}
+
+void HardwareSerial::end() {
+}
+
+void HardwareSerial::flush() {
+  if (this == &Serial) {
+    fflush(stdout);
+  }
+}
+
+int HardwareSerial::available() {
+  return 0;
+}
+
+int HardwareSerial::read() {
+  return -1;
+}
+
+int HardwareSerial::peek() {
+  return -1;
+}
+
+int HardwareSerial::availableForWrite() {
+  return 63;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  if (this != &Serial) {
+    return 1;
+  }
+  if (c != '\r') {
+    putchar(c);
+  }
+  return 1;
+}
+
+HardwareSerial::operator bool() {
+  return true;
+}
+
+HardwareSerial Serial;
+HardwareSerial Serial1;
@@ -0,0 +1,213 @@
+#ifndef Arduino_h
+#define Arduino_h
+
+// Minimal Arduino core for host build. Only things used by storage sources are here.
+
+#include <ctype.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "binary.h"
+
+typedef bool boolean;
+typedef uint8_t byte;
+typedef uint16_t word;
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT        0x0
+#define OUTPUT       0x1
+#define INPUT_PULLUP 0x2
+
+#define LED_BUILTIN 13
+#define A0 54
+#define A1 55
+#define A2 56
+#define A3 57
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define min(a,b) ((a)<(b)?(a):(b))
+#define max(a,b) ((a)>(b)?(a):(b))
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+
+#define lowByte(w) ((uint8_t) ((w) & 0xff))
+#define highByte(w) ((uint8_t) ((w) >> 8))
+
+inline word makeWord(uint8_t h, uint8_t l) {
+  return (h << 8) | l;
+}
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue) (bitvalue ? bitSet(value, bit) : bitClear(value, bit))
+
+#include <avr/pgmspace.h>
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(PSTR(string_literal)))
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+
+/////////////////////////////////////////////////////////////////////
+//                          VIRTUAL CLOCK                          //
+/////////////////////////////////////////////////////////////////////
+
+// Host CPU time is not counted, millis() and micros() are moved only by
+// delays and by emulated hardware latency
+void HOST_advanceMicros(unsigned long us);
+
+/////////////////////////////////////////////////////////////////////
+//                              STRING                             //
+/////////////////////////////////////////////////////////////////////
+
+class String{
+private:
+  char *c_buffer;
+  unsigned int c_capacity;
+  unsigned int c_length;
+
+public:
+  String(const char *cstr = "");
+  String(const String &str);
+  String(const __FlashStringHelper *str);
+  explicit String(char c);
+  explicit String(unsigned char value, unsigned char base = DEC);
+  explicit String(int value, unsigned char base = DEC);
+  explicit String(unsigned int value, unsigned char base = DEC);
+  explicit String(long value, unsigned char base = DEC);
+  explicit String(unsigned long value, unsigned char base = DEC);
+  explicit String(float value, unsigned char decimalPlaces = 2);
+  explicit String(double value, unsigned char decimalPlaces = 2);
+  ~String();
+
+  String& operator=(const String &rhs);
+  String& operator=(const char *cstr);
+
+  unsigned char reserve(unsigned int size);
+  unsigned int length() const;
+
+  unsigned char concat(const String &str);
+  unsigned char concat(const char *cstr);
+  unsigned char concat(char c);
+
+  String& operator+=(const String &rhs);
+  String& operator+=(const char *cstr);
+  String& operator+=(char c);
+  String& operator+=(unsigned char num);
+  String& operator+=(int num);
+  String& operator+=(unsigned int num);
+  String& operator+=(long num);
+  String& operator+=(unsigned long num);
+  String& operator+=(const __FlashStringHelper *str);
+
+  char operator[](unsigned int index) const;
+  char& operator[](unsigned int index);
+  char charAt(unsigned int index) const;
+  const char* c_str() const;
+
+  String substring(unsigned int beginIndex) const;
+  String substring(unsigned int beginIndex, unsigned int endIndex) const;
+  int indexOf(char ch) const;
+  int indexOf(char ch, unsigned int fromIndex) const;
+  long toInt() const;
+  void toUpperCase();
+  void getBytes(unsigned char *buf, unsigned int bufsize, unsigned int index = 0) const;
+  void toCharArray(char *buf, unsigned int bufsize, unsigned int index = 0) const;
+
+  unsigned char equals(const String &s) const;
+  unsigned char startsWith(const String &prefix) const;
+  unsigned char endsWith(const String &suffix) const;
+};
+
+String operator+(const String &lhs, const String &rhs);
+String operator+(const String &lhs, const char *cstr);
+String operator+(const String &lhs, char c);
+
+/////////////////////////////////////////////////////////////////////
+//                              PRINT                              //
+/////////////////////////////////////////////////////////////////////
+
+class Print{
+public:
+  virtual ~Print() {
+  }
+  virtual size_t write(uint8_t) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size);
+  size_t write(const char *str);
+  size_t write(const char *buffer, size_t size);
+
+  size_t print(const __FlashStringHelper *str);
+  size_t print(const String &str);
+  size_t print(const char *str);
+  size_t print(char c);
+  size_t print(unsigned char value, int base = DEC);
+  size_t print(int value, int base = DEC);
+  size_t print(unsigned int value, int base = DEC);
+  size_t print(long value, int base = DEC);
+  size_t print(unsigned long value, int base = DEC);
+  size_t print(double value, int digits = 2);
+
+  size_t println(const __FlashStringHelper *str);
+  size_t println(const String &str);
+  size_t println(const char *str);
+  size_t println(char c);
+  size_t println(unsigned char value, int base = DEC);
+  size_t println(int value, int base = DEC);
+  size_t println(unsigned int value, int base = DEC);
+  size_t println(long value, int base = DEC);
+  size_t println(unsigned long value, int base = DEC);
+  size_t println(double value, int digits = 2);
+  size_t println();
+
+private:
+  size_t printNumber(unsigned long value, uint8_t base);
+};
+
+class Stream : public Print{
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+  String readString();
+};
+
+// Serial prints to stdout, Serial1 (Wi-Fi module) is never connected
+class HardwareSerial : public Stream{
+public:
+  void begin(unsigned long baud);
+  void end();
+  void flush();
+  int available();
+  int read();
+  int peek();
+  int availableForWrite();
+  size_t write(uint8_t c);
+  using Print::write;
+  operator bool();
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+
+// AVR structures have no padding, so keep persistent structures byte compatible
+#pragma pack(1)
+
+#endif
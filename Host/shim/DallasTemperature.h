@@ -0,0 +1,28 @@
+#ifndef DallasTemperature_h
+#define DallasTemperature_h
+
+// Declarations only, thermometer is not linked into host build
+
+#include <OneWire.h>
+
+typedef uint8_t DeviceAddress[8];
+
+#define DEVICE_DISCONNECTED_C -127
+
+class DallasTemperature{
+public:
+  DallasTemperature(OneWire *oneWire) {
+  }
+  void begin();
+  uint8_t getDeviceCount();
+  bool getAddress(uint8_t *deviceAddress, uint8_t index);
+  void requestTemperatures();
+  bool requestTemperaturesByAddress(const uint8_t *deviceAddress);
+  float getTempC(const uint8_t *deviceAddress);
+  float getTempCByIndex(uint8_t index);
+  bool isConnected(const uint8_t *deviceAddress);
+  void setResolution(uint8_t resolution);
+  void setWaitForConversion(bool flag);
+};
+
+#endif
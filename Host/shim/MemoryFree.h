@@ -0,0 +1,6 @@
+#ifndef MEMORY_FREE_H
+#define MEMORY_FREE_H
+
+int freeMemory();
+
+#endif
@@ -0,0 +1,12 @@
+#ifndef OneWire_h
+#define OneWire_h
+
+#include <Arduino.h>
+
+class OneWire{
+public:
+  OneWire(uint8_t pin) {
+  }
+};
+
+#endif
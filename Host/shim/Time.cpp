@@ -0,0 +1,93 @@
+#include "Time.h"
+
+static time_t g_sysTime = 0;
+static unsigned long g_prevMillis = 0;
+static timeStatus_t g_status = timeNotSet;
+
+#define LEAP_YEAR(Y) ( ((1970+(Y))>0) && !((1970+(Y))%4) && ( ((1970+(Y))%100) || !((1970+(Y))%400) ) )
+
+static const uint8_t MONTH_DAYS[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+
+time_t now() {
+  while (millis() - g_prevMillis >= 1000) {
+    g_sysTime++;
+    g_prevMillis += 1000;
+  }
+  return g_sysTime;
+}
+
+void setTime(time_t t) {
+  g_sysTime = t;
+  g_prevMillis = millis();
+  g_status = timeSet;
+}
+
+timeStatus_t timeStatus() {
+  return g_status;
+}
+
+void setSyncProvider(getExternalTime getTimeFunction) {
+  setTime(getTimeFunction());
+}
+
+void breakTime(time_t timeInput, tmElements_t &tm) {
+  uint32_t time = (uint32_t)timeInput;
+  tm.Second = time % 60;
+  time /= 60;
+  tm.Minute = time % 60;
+  time /= 60;
+  tm.Hour = time % 24;
+  time /= 24;
+  tm.Wday = ((time + 4) % 7) + 1; // Sunday is day 1
+
+  uint8_t year = 0;
+  unsigned long days = 0;
+  while ((unsigned)(days += (LEAP_YEAR(year) ? 366 : 365)) <= time) {
+    year++;
+  }
+  tm.Year = year;
+
+  days -= LEAP_YEAR(year) ? 366 : 365;
+  time -= days;
+
+  uint8_t month;
+  uint8_t monthLength = 0;
+  for (month = 0; month < 12; month++) {
+    if (month == 1) {
+      monthLength = LEAP_YEAR(year) ? 29 : 28;
+    }
+    else {
+      monthLength = MONTH_DAYS[month];
+    }
+    if (time >= monthLength) {
+      time -= monthLength;
+    }
+    else {
+      break;
+    }
+  }
+  tm.Month = month + 1;
+  tm.Day = time + 1;
+}
+
+time_t makeTime(tmElements_t &tm) {
+  uint32_t seconds = tm.Year * (SECS_PER_DAY * 365);
+  for (int i = 0; i < tm.Year; i++) {
+    if (LEAP_YEAR(i)) {
+      seconds += SECS_PER_DAY;
+    }
+  }
+  for (int i = 1; i < tm.Month; i++) {
+    if ((i == 2) && LEAP_YEAR(tm.Year)) {
+      seconds += SECS_PER_DAY * 29;
+    }
+    else {
+      seconds += SECS_PER_DAY * MONTH_DAYS[i - 1];
+    }
+  }
+  seconds += (tm.Day - 1) * SECS_PER_DAY;
+  seconds += tm.Hour * SECS_PER_HOUR;
+  seconds += tm.Minute * SECS_PER_MIN;
+  seconds += tm.Second;
+  return (time_t)seconds;
+}
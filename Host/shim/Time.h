@@ -0,0 +1,53 @@
+#ifndef _Time_h
+#define _Time_h
+
+#include <Arduino.h>
+
+// Time library on AVR uses 32 bit time_t, persistent structures depend on it
+typedef uint32_t growbox_time_t;
+#define time_t growbox_time_t
+
+typedef enum{
+  timeNotSet, timeNeedsSync, timeSet
+} timeStatus_t;
+
+typedef struct{
+  uint8_t Second;
+  uint8_t Minute;
+  uint8_t Hour;
+  uint8_t Wday; // day of week, sunday is day 1
+  uint8_t Day;
+  uint8_t Month;
+  uint8_t Year; // offset from 1970
+} tmElements_t;
+
+typedef time_t (*getExternalTime)();
+
+#define tmYearToCalendar(Y) ((Y) + 1970)
+#define CalendarYrToTm(Y)   ((Y) - 1970)
+
+#define SECS_PER_MIN  (60UL)
+#define SECS_PER_HOUR (3600UL)
+#define SECS_PER_DAY  (SECS_PER_HOUR * 24UL)
+#define DAYS_PER_WEEK (7UL)
+#define SECS_PER_WEEK (SECS_PER_DAY * DAYS_PER_WEEK)
+#define SECS_PER_YEAR (SECS_PER_WEEK * 52UL)
+
+#define numberOfSeconds(_time_) (_time_ % SECS_PER_MIN)
+#define numberOfMinutes(_time_) ((_time_ / SECS_PER_MIN) % SECS_PER_MIN)
+#define numberOfHours(_time_) (( _time_% SECS_PER_DAY) / SECS_PER_HOUR)
+#define elapsedDays(_time_) ( _time_ / SECS_PER_DAY)
+#define elapsedSecsToday(_time_) (_time_ % SECS_PER_DAY)
+#define previousMidnight(_time_) (( _time_ / SECS_PER_DAY) * SECS_PER_DAY)
+#define nextMidnight(_time_) ( previousMidnight(_time_) + SECS_PER_DAY)
+
+// Clock is driven by virtual clock, see HOST_advanceMicros()
+time_t now();
+void setTime(time_t t);
+timeStatus_t timeStatus();
+void setSyncProvider(getExternalTime getTimeFunction);
+
+void breakTime(time_t time, tmElements_t &tm);
+time_t makeTime(tmElements_t &tm);
+
+#endif
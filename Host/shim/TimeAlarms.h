@@ -0,0 +1,35 @@
+#ifndef TimeAlarms_h
+#define TimeAlarms_h
+
+// Declarations only, scheduler is not linked into host build
+
+#include <Time.h>
+
+typedef uint8_t AlarmID_t;
+typedef void (*OnTick_t)();
+
+#define dtNBR_ALARMS 6
+#define dtINVALID_ALARM_ID 255
+
+class TimeAlarmsClass{
+public:
+  AlarmID_t alarmRepeat(time_t value, OnTick_t onTickHandler);
+  AlarmID_t alarmOnce(time_t value, OnTick_t onTickHandler);
+  AlarmID_t timerRepeat(time_t value, OnTick_t onTickHandler);
+  AlarmID_t timerOnce(time_t value, OnTick_t onTickHandler);
+  AlarmID_t triggerOnce(time_t value, OnTick_t onTickHandler);
+  void delay(unsigned long ms);
+  void enable(AlarmID_t ID);
+  void disable(AlarmID_t ID);
+  void free(AlarmID_t ID);
+  bool isAllocated(AlarmID_t ID);
+  time_t read(AlarmID_t ID);
+  void write(AlarmID_t ID, time_t value);
+  void serviceAlarms();
+  time_t getNextTrigger();
+  AlarmID_t getTriggeredAlarmId();
+};
+
+extern TimeAlarmsClass Alarm;
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef TwoWire_h
+#define TwoWire_h
+
+// I2C master, the only slave is HOST_EEPROM_AT24C32 emulator, see EEPROMEmulator.h
+
+#include <Arduino.h>
+
+#define BUFFER_LENGTH 32
+
+class TwoWire : public Stream{
+public:
+  void begin();
+  void beginTransmission(uint8_t address);
+  void beginTransmission(int address);
+  uint8_t endTransmission();
+  uint8_t requestFrom(uint8_t address, uint8_t quantity);
+  uint8_t requestFrom(int address, int quantity);
+  size_t write(uint8_t data);
+  size_t write(const uint8_t *data, size_t quantity);
+  using Print::write;
+  int available();
+  int read();
+  int peek();
+};
+
+extern TwoWire Wire;
+
+#endif
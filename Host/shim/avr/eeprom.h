@@ -0,0 +1,15 @@
+#ifndef _AVR_EEPROM_H_
+#define _AVR_EEPROM_H_
+
+// Backed by HOST_EEPROM emulator, see EEPROMEmulator.h
+
+#include <stddef.h>
+#include <stdint.h>
+
+int eeprom_is_ready();
+uint8_t eeprom_read_byte(const uint8_t *address);
+void eeprom_write_byte(uint8_t *address, uint8_t value);
+void eeprom_read_block(void *dst, const void *src, size_t size);
+void eeprom_write_block(const void *src, void *dst, size_t size);
+
+#endif
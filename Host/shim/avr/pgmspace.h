@@ -0,0 +1,25 @@
+#ifndef __PGMSPACE_H_
+#define __PGMSPACE_H_
+
+// Host has single address space, program memory is ordinary memory
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+
+#define pgm_read_byte(address) (*(const uint8_t *)(address))
+#define pgm_read_word(address) (*(const uint16_t *)(address))
+#define pgm_read_dword(address) (*(const uint32_t *)(address))
+#define pgm_read_ptr(address) (*(void * const *)(address))
+
+#define memcpy_P memcpy
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define strlen_P strlen
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+
+#endif
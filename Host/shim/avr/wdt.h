@@ -0,0 +1,10 @@
+#ifndef _AVR_WDT_H_
+#define _AVR_WDT_H_
+
+#define WDTO_8S 9
+
+#define wdt_reset()
+#define wdt_enable(value)
+#define wdt_disable()
+
+#endif
@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+#
+# Generates ../Growbox/StaticFiles.h from static files of this folder.
+# Every file is stored to PROGMEM twice: as plain string and gzip compressed,
+# see WebServerClass::httpStaticFile().
+#
+# Run it after static file is changed, and change version in S_URL_STATIC_* and
+# S_HTTP_STATIC_ETAG of WebServer.h, because browser caches static files.
+
+import gzip
+import os
+
+STATIC_FILES = [
+    ("growbox.css", "S_STATIC_STYLE"),
+    ("growbox.js", "S_STATIC_SCRIPT"),
+]
+
+FOLDER = os.path.dirname(os.path.abspath(__file__))
+OUTPUT = os.path.join(FOLDER, "..", "Growbox", "StaticFiles.h")
+
+
+# Lines are trimmed and joined, lines with "//" comments are removed. Statements must end with ';'
+def minify(text):
+    lines = [line.strip() for line in text.splitlines()]
+    return "".join(line for line in lines if line and not line.startswith("//"))
+
+
+def c_string(text, width=100):
+    escaped = text.replace("\\", "\\\\").replace("\"", "\\\"")
+    return "\n".join("  \"%s\"" % escaped[i:i + width] for i in range(0, len(escaped), width))
+
+
+def c_bytes(data, width=16):
+    return ",\n".join("  " + ", ".join("0x%02X" % b for b in data[i:i + width]) for i in range(0, len(data), width))
+
+
+def main():
+    out = []
+    out.append("// Generated by Static/generate_static_files.py, do not edit")
+    out.append("#ifndef StaticFiles_h")
+    out.append("#define StaticFiles_h")
+    out.append("")
+    out.append("#include <Arduino.h>")
+    for file_name, name in STATIC_FILES:
+        with open(os.path.join(FOLDER, file_name), encoding="utf-8") as f:
+            text = minify(f.read())
+        data = gzip.compress(text.encode("utf-8"), compresslevel=9, mtime=0)
+        out.append("")
+        out.append("// %s, %d bytes, gzip %d bytes" % (file_name, len(text), len(data)))
+        out.append("const char %s[] PROGMEM =\n%s;" % (name, c_string(text)))
+        out.append("const byte %s_GZIP[] PROGMEM = {\n%s\n};" % (name, c_bytes(data)))
+    out.append("")
+    out.append("#endif")
+    out.append("")
+    with open(OUTPUT, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,181 @@
+// Shared by all pages. Pages call functions with own data
+var g_timeFormat={year:'numeric',month:'2-digit',day:'2-digit',hour:'2-digit',minute:'2-digit',second:'2-digit'};
+
+function g_onChangeConfigPageSelect(){
+  var select=document.getElementById('configPageSelect');
+  var newValue=select.value;
+  for(var i=0;i<select.options.length;i++){select.options[i].selected=select.options[i].defaultSelected;}
+  location=newValue;
+}
+
+// See WebServerClass::growboxClockJavaScript()
+function g_startClock(timeStamp,growboxTimeStampId,browserTimeStampId,diffTimeStampId,isAutoCalculated){
+  var gbts=new Date((timeStamp+new Date().getTimezoneOffset()*60)*1000);
+  var tsDiff=new Date().getTime()-gbts;
+  if(diffTimeStampId){
+    var diffStr='';
+    var absTSDiffSec=Math.abs(Math.floor(tsDiff/1000));
+    if(absTSDiffSec>0){
+      var diffSeconds=absTSDiffSec%60;
+      var diffMinutes=Math.floor(absTSDiffSec/60)%60;
+      var diffHours=Math.floor(absTSDiffSec/60/60);
+      if(diffHours>365*24){diffStr='over year';}
+      else if(diffHours>30*24){diffStr='over month';}
+      else if(diffHours>7*24){diffStr='over week';}
+      else if(diffHours>24){diffStr='over day';}
+      else if(diffHours>0){diffStr=diffHours+' h '+diffMinutes+' m '+diffSeconds+' s';}
+      else if(diffMinutes>0){diffStr=diffMinutes+' min '+diffSeconds+' sec';}
+      else{diffStr=diffSeconds+' sec';}
+      diffStr='Out of sync '+diffStr+' with browser time';
+    }else{
+      diffStr='Synced with browser time';
+    }
+    var diffTimeStamp=document.getElementById(diffTimeStampId);
+    if(isAutoCalculated){diffStr='Auto calculated. '+diffStr;diffTimeStamp.style.color='red';}
+    else if(absTSDiffSec>60){diffTimeStamp.style.color='red';}
+    diffTimeStamp.innerHTML=diffStr;
+  }
+  function updateTimeStamps(){
+    // bts is browser time stamp
+    var bts=new Date();
+    gbts.setTime(bts.getTime()-tsDiff);
+    if(growboxTimeStampId){document.getElementById(growboxTimeStampId).innerHTML=gbts.toLocaleString('uk',g_timeFormat);}
+    if(browserTimeStampId){document.getElementById(browserTimeStampId).innerHTML=bts.toLocaleString('uk',g_timeFormat);}
+    setTimeout(updateTimeStamps,1000);
+  }
+  updateTimeStamps();
+}
+
+function g_checkBeforeSetClockTime(hiddenInputId){
+  if(!confirm('Syncronize Growbox time with browser time?')){return false;}
+  document.getElementById(hiddenInputId).value=Math.floor(new Date().getTime()/1000-new Date().getTimezoneOffset()*60);
+  return true;
+}
+
+// See WebServerClass::updateDayNightPeriodJavaScript()
+function g_wordTimeToString(time){
+  var hour=Math.floor(time/60);
+  var minute=time%60;
+  return (hour<10?'0':'')+hour+':'+(minute<10?'0':'')+minute;
+}
+function g_updDayNightPeriod(){
+  var upTime=new Date('01.01.2000 '+document.getElementById('turnToDayModeAt').value+':00');
+  var downTime=new Date('01.01.2000 '+document.getElementById('turnToNightModeAt').value+':00');
+  // delta in minutes
+  var delta=Math.floor((downTime-upTime)/1000/60);
+  var dayPeriod=(delta>0?delta:24*60+delta);
+  document.getElementById('dayNightPeriod').innerHTML=g_wordTimeToString(dayPeriod)+'/'+g_wordTimeToString(24*60-dayPeriod);
+}
+
+// Log page, see WebServerClass::sendLogPage(). Records are [time stamp, 4 bytes][data][data1], little-endian.
+// Descriptions are loaded from g_logDescriptions, see LoggerClass::printLogRecordDescriptionsScript()
+var g_logRecords=[];
+var g_logDate='';
+
+function g_twoDigits(number){
+  return (number<10?'0':'')+number;
+}
+function g_logDay(timeStamp){
+  var date=new Date(timeStamp*1000);
+  return g_twoDigits(date.getUTCDate())+'.'+g_twoDigits(date.getUTCMonth()+1)+'.'+date.getUTCFullYear();
+}
+function g_logTime(timeStamp){
+  var date=new Date(timeStamp*1000);
+  return g_twoDigits(date.getUTCHours())+':'+g_twoDigits(date.getUTCMinutes())+':'+g_twoDigits(date.getUTCSeconds());
+}
+function g_isLogRecordEmpty(record){
+  return (record.timeStamp==0&&record.data==0&&record.data1==0);
+}
+function g_isLogRecordPassTypeFilter(record,type){
+  var types={events:0,errors:1,wateringevents:2,temperature:3};
+  if(!(type in types)){return true;}
+  return !g_isLogRecordEmpty(record)&&(record.data>>6)==types[type];
+}
+function g_logRecordDescription(record){
+  var descriptions=g_logDescriptions;
+  var code=record.data&63;
+  var type=record.data>>6;
+  if(g_isLogRecordEmpty(record)){return 'Log record not loaded';}
+  if(type==0){
+    var text=descriptions.e[code]||'Unknown Event';
+    if(descriptions.fan.indexOf(code)>=0&&record.data1!=0){
+      text+=', '+(record.data1>>4)*descriptions.step+'/'+(record.data1&15)*descriptions.step+' min';
+    }
+    return text;
+  }
+  if(type==1){return descriptions.r[code]||'Unknown Error';}
+  if(type==3){return 'Temperature '+code+'&deg;C';}
+  var wateringEvent=descriptions.w[code&15];
+  var text=(wateringEvent?wateringEvent[0]:'Unknown Watering event')+' system #'+((code>>4)+1);
+  if(wateringEvent&&wateringEvent[1]==1){text+=', value '+record.data1;}
+  else if(wateringEvent&&wateringEvent[1]==2){text+=' during '+record.data1+' sec';}
+  return text;
+}
+
+function g_showLog(url,date){
+  g_logDate=date;
+  var request=new XMLHttpRequest();
+  request.open('GET',url);
+  request.responseType='arraybuffer';
+  request.onload=function(){
+    var view=new DataView(request.response);
+    for(var i=0;i+6<=view.byteLength;i+=6){
+      g_logRecords.push({timeStamp:view.getUint32(i,true),data:view.getUint8(i+4),data1:view.getUint8(i+5)});
+    }
+    g_updateLog();
+  };
+  request.onerror=function(){document.getElementById('logTable').innerHTML='Log loading failed';};
+  request.send();
+}
+
+// Days and table are built again on filter change, records are not reloaded
+function g_updateLog(){
+  var type=document.getElementById('typeCombobox').value;
+  var dateCombobox=document.getElementById('dateCombobox');
+  if(dateCombobox.value){g_logDate=dateCombobox.value;}
+  var isAllTypes=(type=='all');
+  var isAllDays=(g_logDate=='all');
+
+  // counts are [printable, all]
+  var days=[];
+  var dayCounts={};
+  var allCounts=[0,0];
+  var rows='';
+  var lastDay='';
+  for(var i=0;i<g_logRecords.length;i++){
+    var record=g_logRecords[i];
+    var day=g_logDay(record.timeStamp);
+    if(!(day in dayCounts)){dayCounts[day]=[0,0];days.push(day);}
+    dayCounts[day][1]++;
+    allCounts[1]++;
+    if(!g_isLogRecordPassTypeFilter(record,type)){continue;}
+    dayCounts[day][0]++;
+    allCounts[0]++;
+    if(!isAllDays&&day!=g_logDate){continue;}
+    var style='';
+    if((record.data>>6)==1||g_isLogRecordEmpty(record)){style='color:red;';}
+    else if((record.data>>6)==0&&g_logDescriptions.bold.indexOf(record.data)>=0){style='font-weight:bold;';}
+    rows+='<tr><td>'+(isAllDays?allCounts[0]:dayCounts[day][0])+'</td>';
+    if(isAllDays){rows+="<td style='font-weight:bold;'>"+(day!=lastDay?day:'')+'</td>';}
+    rows+='<td>'+g_logTime(record.timeStamp)+"</td><td style='text-align:left;"+style+"'>"+g_logRecordDescription(record)+'</td></tr>';
+    lastDay=day;
+  }
+  if(!isAllDays&&!(g_logDate in dayCounts)){dayCounts[g_logDate]=[0,0];days.push(g_logDate);}
+
+  var options='';
+  function countsText(counts){return '  ('+(isAllTypes?'':counts[0]+'/')+counts[1]+')';}
+  function option(value,text,isSelected){
+    return "<option value='"+value+"'"+(isSelected?" selected='selected' style='font-weight:bold;'":'')+'>'+text+'</option>';
+  }
+  for(var i=0;i<days.length;i++){options+=option(days[i],days[i]+countsText(dayCounts[days[i]]),days[i]==g_logDate);}
+  options+=option('all','All days'+countsText(allCounts),isAllDays);
+  dateCombobox.innerHTML=options;
+
+  var table=document.getElementById('logTable');
+  if(rows){
+    table.innerHTML="<table class='grab align_center'><tr><th>#</th>"+(isAllDays?'<th>Day</th>':'')+'<th>Time</th><th>Description</th></tr>'+rows+'</table>';
+  }else{
+    var typeNames={events:'Event',wateringevents:'Watering event',errors:'Error',temperature:'Temperature'};
+    table.innerHTML='<br/>'+(typeNames[type]||'Log')+' records not found for '+(isAllDays?'all days':g_logDate);
+  }
+}